@@ -31,3 +31,46 @@ export declare function listBackends(): Promise<any>;
 export declare function listProfiles(): Promise<any>;
 export declare function prove(cfg: ProveConfig): Promise<ProveResult>;
 export declare function verify(cfg: ProveConfig, proof: Buffer): Promise<VerifyResult>;
+
+export type SessionConfig = Omit<ProveConfig, 'publicInputsJson'>;
+
+export type ProveBatchResult = {
+  proofs: Buffer[];
+  meta: {
+    count: number;
+    proofs: { digest: string; proof_len: number }[];
+    [k: string]: any;
+  };
+};
+
+export declare function proveBatch(
+  cfg: SessionConfig,
+  publicInputsJsonList: string[],
+): Promise<ProveBatchResult>;
+
+export declare function sessionOpen(cfg: SessionConfig): Promise<number>;
+export declare function sessionProve(
+  session: number,
+  publicInputsJson: string,
+): Promise<ProveResult>;
+export declare function sessionVerify(
+  session: number,
+  publicInputsJson: string,
+  proof: Buffer,
+): Promise<VerifyResult>;
+export declare function sessionClose(session: number): Promise<void>;
+
+export type PoolOptions = {
+  threads?: number;
+  maxInFlight?: number;
+};
+
+export type PoolStats = {
+  threads: number;
+  maxInFlight: number;
+  inFlight: number;
+  queued: number;
+};
+
+export declare function configurePool(options: PoolOptions): void;
+export declare function poolStats(): PoolStats;
@@ -127,13 +127,48 @@ async function prove(cfg) {
   return getBinding().prove(cfg);
 }
 
+async function proveBatch(cfg, publicInputsJsonList) {
+  return getBinding().proveBatch(cfg, publicInputsJsonList);
+}
+
 async function verify(cfg, proof) {
   return getBinding().verify(cfg, proof);
 }
 
+async function sessionOpen(cfg) {
+  return getBinding().sessionOpen(cfg);
+}
+
+async function sessionProve(session, publicInputsJson) {
+  return getBinding().sessionProve(session, publicInputsJson);
+}
+
+async function sessionVerify(session, publicInputsJson, proof) {
+  return getBinding().sessionVerify(session, publicInputsJson, proof);
+}
+
+async function sessionClose(session) {
+  return getBinding().sessionClose(session);
+}
+
+function configurePool(options) {
+  getBinding().configurePool(options);
+}
+
+function poolStats() {
+  return getBinding().poolStats();
+}
+
 module.exports = {
   listBackends,
   listProfiles,
   prove,
+  proveBatch,
   verify,
+  sessionOpen,
+  sessionProve,
+  sessionVerify,
+  sessionClose,
+  configurePool,
+  poolStats,
 };
@@ -11,6 +11,17 @@ export type ProveConfig = {
   publicInputsJson: string;
 };
 
+export type SessionConfig = Omit<ProveConfig, 'publicInputsJson'>;
+
+export type ProveBatchResult = {
+  proofs: Buffer[];
+  meta: {
+    count: number;
+    proofs: { digest: string; proof_len: number }[];
+    [k: string]: any;
+  };
+};
+
 export type ProveResult = {
   proof: Buffer;
   meta: {
@@ -28,11 +39,34 @@ export type VerifyResult = {
   };
 };
 
+export type PoolOptions = {
+  threads?: number;
+  maxInFlight?: number;
+};
+
+export type PoolStats = {
+  threads: number;
+  maxInFlight: number;
+  inFlight: number;
+  queued: number;
+};
+
 type NativeBinding = {
   listBackends: () => Promise<any>;
   listProfiles: () => Promise<any>;
   prove: (cfg: ProveConfig) => Promise<ProveResult>;
+  proveBatch: (cfg: SessionConfig, publicInputsJsonList: string[]) => Promise<ProveBatchResult>;
   verify: (cfg: ProveConfig, proof: Buffer) => Promise<VerifyResult>;
+  sessionOpen: (cfg: SessionConfig) => Promise<number>;
+  sessionProve: (session: number, publicInputsJson: string) => Promise<ProveResult>;
+  sessionVerify: (
+    session: number,
+    publicInputsJson: string,
+    proof: Buffer,
+  ) => Promise<VerifyResult>;
+  sessionClose: (session: number) => Promise<void>;
+  configurePool: (options: PoolOptions) => void;
+  poolStats: () => PoolStats;
 };
 
 function loadNativeBinding(): NativeBinding {
@@ -168,6 +202,44 @@ export async function prove(cfg: ProveConfig): Promise<ProveResult> {
   return getBinding().prove(cfg);
 }
 
+export async function proveBatch(
+  cfg: SessionConfig,
+  publicInputsJsonList: string[],
+): Promise<ProveBatchResult> {
+  return getBinding().proveBatch(cfg, publicInputsJsonList);
+}
+
 export async function verify(cfg: ProveConfig, proof: Buffer): Promise<VerifyResult> {
   return getBinding().verify(cfg, proof);
 }
+
+export async function sessionOpen(cfg: SessionConfig): Promise<number> {
+  return getBinding().sessionOpen(cfg);
+}
+
+export async function sessionProve(
+  session: number,
+  publicInputsJson: string,
+): Promise<ProveResult> {
+  return getBinding().sessionProve(session, publicInputsJson);
+}
+
+export async function sessionVerify(
+  session: number,
+  publicInputsJson: string,
+  proof: Buffer,
+): Promise<VerifyResult> {
+  return getBinding().sessionVerify(session, publicInputsJson, proof);
+}
+
+export async function sessionClose(session: number): Promise<void> {
+  return getBinding().sessionClose(session);
+}
+
+export function configurePool(options: PoolOptions): void {
+  getBinding().configurePool(options);
+}
+
+export function poolStats(): PoolStats {
+  return getBinding().poolStats();
+}
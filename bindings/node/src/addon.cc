@@ -2,10 +2,16 @@
 #include "zkprov.h"
 
 #include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <limits>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -135,6 +141,59 @@ bool ParseMeta(Napi::Env env, const std::string &json, uint64_t expected_proof_l
   return true;
 }
 
+// Matches the envelope hex convention: lowercase with a 0x prefix.
+std::string HexEncode(const uint8_t *bytes, size_t len) {
+  static const char kHex[] = "0123456789abcdef";
+  std::string out;
+  out.reserve(len * 2 + 2);
+  out.append("0x");
+  for (size_t i = 0; i < len; ++i) {
+    out.push_back(kHex[bytes[i] >> 4]);
+    out.push_back(kHex[bytes[i] & 0x0f]);
+  }
+  return out;
+}
+
+// Build the meta result object straight from the fixed-layout binary struct,
+// skipping the JSON serialize-parse-validate loop on the one-shot paths.
+Napi::Object BuildBinaryMeta(Napi::Env env, const zkp_proof_meta &meta) {
+  Napi::Object obj = Napi::Object::New(env);
+  obj.Set("digest", Napi::String::New(env, HexEncode(meta.digest, sizeof meta.digest)));
+  obj.Set("proof_len", Napi::Number::New(env, static_cast<double>(meta.proof_len)));
+  if (meta.verified != 0) {
+    obj.Set("verified", Napi::Boolean::New(env, true));
+  }
+  obj.Set("backend_hash", Napi::String::New(env, std::to_string(meta.backend_hash)));
+  obj.Set("profile_hash", Napi::String::New(env, std::to_string(meta.profile_hash)));
+  obj.Set("elapsed_micros", Napi::Number::New(env, static_cast<double>(meta.elapsed_micros)));
+  obj.Set("meta_version", Napi::Number::New(env, static_cast<double>(meta.version)));
+  return obj;
+}
+
+// Wrap a zkp_prove allocation in a Buffer without copying. The buffer adopts
+// the allocation and releases it through zkp_free once V8 collects it, so
+// large proofs cross the FFI boundary exactly once. Runtimes that forbid
+// external-backed buffers fall back to a copy and free the allocation
+// immediately.
+Napi::Buffer<uint8_t> AdoptProofBuffer(Napi::Env env, uint8_t *proof_ptr, uint64_t proof_len) {
+  if (proof_ptr == nullptr || proof_len == 0) {
+    if (proof_ptr != nullptr) {
+      zkp_free(proof_ptr);
+    }
+    return Napi::Buffer<uint8_t>::New(env, 0);
+  }
+
+#ifdef NODE_API_NO_EXTERNAL_BUFFERS_ALLOWED
+  Napi::Buffer<uint8_t> buffer =
+      Napi::Buffer<uint8_t>::Copy(env, proof_ptr, static_cast<size_t>(proof_len));
+  zkp_free(proof_ptr);
+  return buffer;
+#else
+  return Napi::Buffer<uint8_t>::New(env, proof_ptr, static_cast<size_t>(proof_len),
+                                    [](Napi::Env /*env*/, uint8_t *data) { zkp_free(data); });
+#endif
+}
+
 struct CommonConfig {
   std::string backend_id;
   std::string field;
@@ -168,7 +227,11 @@ bool GetStringProperty(const Napi::Object &obj, const char *key, bool allow_empt
   return true;
 }
 
-bool ParseCommonConfig(const Napi::Value &value, CommonConfig *out_config, std::string *detail) {
+// Parse the configuration fields shared by prove/verify and session opens.
+// `require_public_inputs` is false for session configs, where public inputs
+// arrive per call rather than per handle.
+bool ParseConfigFields(const Napi::Value &value, bool require_public_inputs,
+                       CommonConfig *out_config, std::string *detail) {
   if (!value.IsObject()) {
     *detail = "Configuration must be an object";
     return false;
@@ -190,7 +253,8 @@ bool ParseCommonConfig(const Napi::Value &value, CommonConfig *out_config, std::
   if (!GetStringProperty(obj, "airPath", false, &out_config->air_path, detail)) {
     return false;
   }
-  if (!GetStringProperty(obj, "publicInputsJson", true, &out_config->public_inputs_json, detail)) {
+  if (require_public_inputs &&
+      !GetStringProperty(obj, "publicInputsJson", true, &out_config->public_inputs_json, detail)) {
     return false;
   }
 
@@ -216,32 +280,189 @@ bool ParseCommonConfig(const Napi::Value &value, CommonConfig *out_config, std::
   return true;
 }
 
-class PromiseWorker : public Napi::AsyncWorker {
+bool ParseCommonConfig(const Napi::Value &value, CommonConfig *out_config, std::string *detail) {
+  return ParseConfigFields(value, true, out_config, detail);
+}
+
+bool ParseSessionConfig(const Napi::Value &value, CommonConfig *out_config, std::string *detail) {
+  return ParseConfigFields(value, false, out_config, detail);
+}
+
+bool ParseSessionHandle(const Napi::Value &value, uint64_t *out_handle, std::string *detail) {
+  if (!value.IsNumber()) {
+    *detail = "Session handle must be a number";
+    return false;
+  }
+  double handle = value.As<Napi::Number>().DoubleValue();
+  if (handle < 1.0 || std::floor(handle) != handle) {
+    *detail = "Session handle must be a positive integer";
+    return false;
+  }
+  *out_handle = static_cast<uint64_t>(handle);
+  return true;
+}
+
+// Dedicated worker pool for the blocking zkp_* calls. Keeping prover work off
+// the default libuv pool stops verify bursts from starving file I/O and DNS
+// lookups that share it, and gives callers an explicit max-in-flight bound
+// plus a queue-depth counter they can export to metrics.
+class WorkerPool {
+ public:
+  static WorkerPool &Instance() {
+    // Intentionally leaked: workers are detached and block in cv_.wait, so a
+    // static's destructor would tear down mutex_/cv_ underneath them at
+    // process exit. The OS reclaims everything anyway.
+    static WorkerPool *pool = new WorkerPool;
+    return *pool;
+  }
+
+  // Returns false (with a detail message) when shrinking a started pool is
+  // requested; thread count can only grow once workers are running.
+  bool Configure(size_t threads, size_t max_in_flight, std::string *detail) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (threads == 0 || max_in_flight == 0) {
+      *detail = "threads and maxInFlight must be positive";
+      return false;
+    }
+    if (started_ && threads < thread_count_) {
+      *detail = "cannot shrink a started worker pool";
+      return false;
+    }
+    if (started_ && threads > thread_count_) {
+      SpawnLocked(threads - thread_count_);
+    }
+    thread_count_ = threads;
+    max_in_flight_ = max_in_flight;
+    return true;
+  }
+
+  // Accepts the task unless the in-flight limit (queued + running) is
+  // reached. Workers start lazily on first submission.
+  bool Submit(std::function<void()> task, std::string *detail) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!started_) {
+      SpawnLocked(thread_count_);
+      started_ = true;
+    }
+    if (in_flight_ >= max_in_flight_) {
+      std::ostringstream oss;
+      oss << "Worker pool saturated (" << in_flight_ << " tasks in flight, limit "
+          << max_in_flight_ << ")";
+      *detail = oss.str();
+      return false;
+    }
+    ++in_flight_;
+    queue_.push_back(std::move(task));
+    cv_.notify_one();
+    return true;
+  }
+
+  void Stats(size_t *threads, size_t *max_in_flight, size_t *in_flight, size_t *queued) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    *threads = thread_count_;
+    *max_in_flight = max_in_flight_;
+    *in_flight = in_flight_;
+    *queued = queue_.size();
+  }
+
+ private:
+  WorkerPool() = default;
+
+  void SpawnLocked(size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      std::thread([this] { WorkerLoop(); }).detach();
+    }
+  }
+
+  void WorkerLoop() {
+    for (;;) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return !queue_.empty(); });
+        task = std::move(queue_.front());
+        queue_.pop_front();
+      }
+      task();
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --in_flight_;
+      }
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::function<void()>> queue_;
+  bool started_ = false;
+  size_t thread_count_ = 4;
+  size_t max_in_flight_ = 256;
+  size_t in_flight_ = 0;  // queued + running
+};
+
+// Promise-returning task that runs Execute() on the dedicated WorkerPool and
+// then OnOK()/OnError() back on the JS thread via a thread-safe function.
+// Mirrors the Napi::AsyncWorker contract the workers were written against.
+class PromiseWorker {
  public:
   explicit PromiseWorker(Napi::Env env)
-      : Napi::AsyncWorker(env), deferred_(Napi::Promise::Deferred::New(env)) {}
+      : env_(env), deferred_(Napi::Promise::Deferred::New(env)) {}
+
+  virtual ~PromiseWorker() = default;
 
   Napi::Promise GetPromise() { return deferred_.Promise(); }
 
+  void Queue() {
+    tsfn_ = Napi::ThreadSafeFunction::New(
+        env_, Napi::Function::New(env_, [](const Napi::CallbackInfo &) {}), "zkprov:worker", 0, 1);
+    std::string detail;
+    if (!WorkerPool::Instance().Submit([this] { RunTask(); }, &detail)) {
+      deferred_.Reject(CreateErrorObject(env_, ZKP_ERR_INTERNAL, detail, "Worker pool saturated"));
+      tsfn_.Release();
+      delete this;
+    }
+  }
+
  protected:
+  Napi::Env Env() { return env_; }
+
+  virtual void Execute() = 0;
+  virtual void OnOK() = 0;
+
+  virtual void OnError() {
+    Napi::Object err = CreateErrorObject(env_, error_code_, error_detail_, error_message_);
+    deferred_.Reject(err);
+  }
+
   void Fail(int32_t code, const std::string &detail, const std::string &message = std::string()) {
+    failed_ = true;
     error_code_ = code;
     error_detail_ = detail;
     error_message_ = message.empty() ? std::string(GetErrorMessage(code)) : message;
-    SetError(error_message_);
-  }
-
-  void OnError(const Napi::Error & /*error*/) override {
-    Napi::Env env = Env();
-    Napi::Object err = CreateErrorObject(env, error_code_, error_detail_, error_message_);
-    deferred_.Reject(err);
   }
 
   void Resolve(const Napi::Value &value) { deferred_.Resolve(value); }
   void Reject(const Napi::Value &value) { deferred_.Reject(value); }
 
  private:
+  void RunTask() {
+    Execute();
+    tsfn_.BlockingCall(this, [](Napi::Env env, Napi::Function /*callback*/, PromiseWorker *self) {
+      Napi::HandleScope scope(env);
+      if (self->failed_) {
+        self->OnError();
+      } else {
+        self->OnOK();
+      }
+      self->tsfn_.Release();
+      delete self;
+    });
+  }
+
+  Napi::Env env_;
   Napi::Promise::Deferred deferred_;
+  Napi::ThreadSafeFunction tsfn_;
+  bool failed_ = false;
   int32_t error_code_ = ZKP_ERR_INTERNAL;
   std::string error_detail_;
   std::string error_message_;
@@ -314,6 +535,11 @@ class ProveWorker : public PromiseWorker {
   ProveWorker(Napi::Env env, CommonConfig config)
       : PromiseWorker(env), config_(std::move(config)) {}
 
+  ProveWorker(Napi::Env env, uint64_t session, std::string public_inputs_json)
+      : PromiseWorker(env), session_(session) {
+    config_.public_inputs_json = std::move(public_inputs_json);
+  }
+
   ~ProveWorker() override {
     if (proof_ptr_ != nullptr) {
       zkp_free(proof_ptr_);
@@ -323,19 +549,26 @@ class ProveWorker : public PromiseWorker {
 
  protected:
   void Execute() override {
-    int32_t rc = zkp_init();
-    if (rc != ZKP_OK) {
-      Fail(rc, "zkp_init failed");
-      return;
-    }
-
     uint8_t *proof_ptr = nullptr;
     uint64_t proof_len = 0;
     char *meta_json = nullptr;
+    int32_t rc;
+
+    if (session_ != 0) {
+      rc = zkp_session_prove(session_, config_.public_inputs_json.c_str(), &proof_ptr, &proof_len,
+                             &meta_json);
+    } else {
+      rc = zkp_init();
+      if (rc != ZKP_OK) {
+        Fail(rc, "zkp_init failed");
+        return;
+      }
 
-    rc = zkp_prove(config_.backend_id.c_str(), config_.field.c_str(), config_.hash_id.c_str(),
-                   config_.fri_arity, config_.profile_id.c_str(), config_.air_path.c_str(),
-                   config_.public_inputs_json.c_str(), &proof_ptr, &proof_len, &meta_json);
+      rc = zkp_prove2(config_.backend_id.c_str(), config_.field.c_str(), config_.hash_id.c_str(),
+                      config_.fri_arity, config_.profile_id.c_str(), config_.air_path.c_str(),
+                      config_.public_inputs_json.c_str(), &proof_ptr, &proof_len, &binary_meta_);
+      has_binary_meta_ = rc == ZKP_OK;
+    }
     if (rc != ZKP_OK) {
       if (proof_ptr != nullptr) {
         zkp_free(proof_ptr);
@@ -343,7 +576,7 @@ class ProveWorker : public PromiseWorker {
       if (meta_json != nullptr) {
         zkp_free(meta_json);
       }
-      Fail(rc, "zkp_prove failed");
+      Fail(rc, session_ != 0 ? "zkp_session_prove failed" : "zkp_prove failed");
       return;
     }
 
@@ -359,24 +592,29 @@ class ProveWorker : public PromiseWorker {
     Napi::Env env = Env();
     Napi::Object result = Napi::Object::New(env);
 
-    Napi::Buffer<uint8_t> proof_buffer;
-    if (proof_ptr_ != nullptr) {
-      if (proof_len_ > 0) {
-        proof_buffer = Napi::Buffer<uint8_t>::Copy(env, proof_ptr_, static_cast<size_t>(proof_len_));
-      } else {
-        proof_buffer = Napi::Buffer<uint8_t>::New(env, 0);
-      }
-      zkp_free(proof_ptr_);
-      proof_ptr_ = nullptr;
-    } else {
-      proof_buffer = Napi::Buffer<uint8_t>::New(env, 0);
-    }
+    // Ownership of the proof allocation moves into the buffer (or is released
+    // by AdoptProofBuffer on the copy fallback), so drop our pointer first.
+    uint8_t *proof_ptr = proof_ptr_;
+    proof_ptr_ = nullptr;
+    Napi::Buffer<uint8_t> proof_buffer = AdoptProofBuffer(env, proof_ptr, proof_len_);
 
-    std::string detail;
     Napi::Object meta_obj;
-    if (!ParseMeta(env, meta_json_, proof_buffer.Length(), true, &meta_obj, &detail)) {
-      Reject(CreateErrorObject(env, ZKP_ERR_INTERNAL, detail, "Invalid meta returned from zkp_prove"));
-      return;
+    if (has_binary_meta_) {
+      if (binary_meta_.proof_len != proof_buffer.Length()) {
+        std::ostringstream oss;
+        oss << "Meta proof_len " << binary_meta_.proof_len << " does not match expected "
+            << proof_buffer.Length();
+        Reject(CreateErrorObject(env, ZKP_ERR_INTERNAL, oss.str(),
+                                 "Invalid meta returned from zkp_prove2"));
+        return;
+      }
+      meta_obj = BuildBinaryMeta(env, binary_meta_);
+    } else {
+      std::string detail;
+      if (!ParseMeta(env, meta_json_, proof_buffer.Length(), true, &meta_obj, &detail)) {
+        Reject(CreateErrorObject(env, ZKP_ERR_INTERNAL, detail, "Invalid meta returned from zkp_prove"));
+        return;
+      }
     }
 
     result.Set("proof", proof_buffer);
@@ -386,9 +624,12 @@ class ProveWorker : public PromiseWorker {
 
  private:
   CommonConfig config_;
+  uint64_t session_ = 0;
   uint8_t *proof_ptr_ = nullptr;
   uint64_t proof_len_ = 0;
   std::string meta_json_;
+  zkp_proof_meta binary_meta_ = {};
+  bool has_binary_meta_ = false;
 };
 
 class VerifyWorker : public PromiseWorker {
@@ -400,18 +641,36 @@ class VerifyWorker : public PromiseWorker {
         proof_ptr_(proof.Data()),
         proof_len_(static_cast<uint64_t>(proof.Length())) {}
 
+  VerifyWorker(Napi::Env env, uint64_t session, std::string public_inputs_json,
+               Napi::Buffer<uint8_t> proof)
+      : PromiseWorker(env),
+        session_(session),
+        proof_ref_(Napi::Persistent(proof)),
+        proof_ptr_(proof.Data()),
+        proof_len_(static_cast<uint64_t>(proof.Length())) {
+    config_.public_inputs_json = std::move(public_inputs_json);
+  }
+
  protected:
   void Execute() override {
-    int32_t rc = zkp_init();
-    if (rc != ZKP_OK) {
-      Fail(rc, "zkp_init failed");
-      return;
-    }
-
     char *meta_json = nullptr;
-    rc = zkp_verify(config_.backend_id.c_str(), config_.field.c_str(), config_.hash_id.c_str(),
-                    config_.fri_arity, config_.profile_id.c_str(), config_.air_path.c_str(),
-                    config_.public_inputs_json.c_str(), proof_ptr_, proof_len_, &meta_json);
+    int32_t rc;
+
+    if (session_ != 0) {
+      rc = zkp_session_verify(session_, config_.public_inputs_json.c_str(), proof_ptr_, proof_len_,
+                              &meta_json);
+    } else {
+      rc = zkp_init();
+      if (rc != ZKP_OK) {
+        Fail(rc, "zkp_init failed");
+        return;
+      }
+
+      rc = zkp_verify2(config_.backend_id.c_str(), config_.field.c_str(), config_.hash_id.c_str(),
+                       config_.fri_arity, config_.profile_id.c_str(), config_.air_path.c_str(),
+                       config_.public_inputs_json.c_str(), proof_ptr_, proof_len_, &binary_meta_);
+      has_binary_meta_ = rc == ZKP_OK;
+    }
 
     if (rc == ZKP_OK) {
       verified_ = true;
@@ -421,7 +680,7 @@ class VerifyWorker : public PromiseWorker {
       if (meta_json != nullptr) {
         zkp_free(meta_json);
       }
-      Fail(rc, "zkp_verify failed");
+      Fail(rc, session_ != 0 ? "zkp_session_verify failed" : "zkp_verify failed");
       return;
     }
 
@@ -438,7 +697,9 @@ class VerifyWorker : public PromiseWorker {
 
     std::string detail;
     Napi::Object meta_obj;
-    if (!meta_json_.empty()) {
+    if (has_binary_meta_) {
+      meta_obj = BuildBinaryMeta(env, binary_meta_);
+    } else if (!meta_json_.empty()) {
       if (!ParseMeta(env, meta_json_, proof_len_, false, &meta_obj, &detail)) {
         Reject(CreateErrorObject(env, ZKP_ERR_INTERNAL, detail, "Invalid meta returned from zkp_verify"));
         return;
@@ -453,11 +714,155 @@ class VerifyWorker : public PromiseWorker {
 
  private:
   CommonConfig config_;
+  uint64_t session_ = 0;
   Napi::Reference<Napi::Buffer<uint8_t>> proof_ref_;
   const uint8_t *proof_ptr_ = nullptr;
   uint64_t proof_len_ = 0;
   bool verified_ = false;
   std::string meta_json_;
+  zkp_proof_meta binary_meta_ = {};
+  bool has_binary_meta_ = false;
+};
+
+class ProveBatchWorker : public PromiseWorker {
+ public:
+  ProveBatchWorker(Napi::Env env, CommonConfig config, std::vector<std::string> inputs)
+      : PromiseWorker(env), config_(std::move(config)), inputs_(std::move(inputs)) {}
+
+  ~ProveBatchWorker() override { ReleaseNative(); }
+
+ protected:
+  void Execute() override {
+    int32_t rc = zkp_init();
+    if (rc != ZKP_OK) {
+      Fail(rc, "zkp_init failed");
+      return;
+    }
+
+    std::vector<const char *> input_ptrs;
+    input_ptrs.reserve(inputs_.size());
+    for (const std::string &input : inputs_) {
+      input_ptrs.push_back(input.c_str());
+    }
+
+    char *meta_json = nullptr;
+    rc = zkp_prove_batch(config_.backend_id.c_str(), config_.field.c_str(),
+                         config_.hash_id.c_str(), config_.fri_arity, config_.profile_id.c_str(),
+                         config_.air_path.c_str(), input_ptrs.data(),
+                         static_cast<uint64_t>(input_ptrs.size()), &proof_ptrs_, &proof_lens_,
+                         &meta_json);
+    if (rc != ZKP_OK) {
+      Fail(rc, "zkp_prove_batch failed");
+      return;
+    }
+
+    if (meta_json != nullptr) {
+      meta_json_ = meta_json;
+      zkp_free(meta_json);
+    }
+  }
+
+  void OnOK() override {
+    Napi::Env env = Env();
+    Napi::Array proofs = Napi::Array::New(env, inputs_.size());
+    for (size_t i = 0; i < inputs_.size(); ++i) {
+      // Each buffer adopts its allocation; clear the slot so ReleaseNative
+      // does not double-free what V8 now owns.
+      uint8_t *proof_ptr = proof_ptrs_[i];
+      proof_ptrs_[i] = nullptr;
+      proofs.Set(static_cast<uint32_t>(i), AdoptProofBuffer(env, proof_ptr, proof_lens_[i]));
+    }
+    ReleaseNative();
+
+    std::string detail;
+    Napi::Value meta_value;
+    if (!ParseJson(env, meta_json_, &meta_value, &detail) || !meta_value.IsObject()) {
+      if (detail.empty()) {
+        detail = "Meta response is empty";
+      }
+      Reject(CreateErrorObject(env, ZKP_ERR_INTERNAL, detail,
+                               "Invalid meta returned from zkp_prove_batch"));
+      return;
+    }
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("proofs", proofs);
+    result.Set("meta", meta_value.As<Napi::Object>());
+    Resolve(result);
+  }
+
+ private:
+  void ReleaseNative() {
+    if (proof_ptrs_ != nullptr) {
+      for (size_t i = 0; i < inputs_.size(); ++i) {
+        if (proof_ptrs_[i] != nullptr) {
+          zkp_free(proof_ptrs_[i]);
+        }
+      }
+      zkp_free(proof_ptrs_);
+      proof_ptrs_ = nullptr;
+    }
+    if (proof_lens_ != nullptr) {
+      zkp_free(proof_lens_);
+      proof_lens_ = nullptr;
+    }
+  }
+
+  CommonConfig config_;
+  std::vector<std::string> inputs_;
+  uint8_t **proof_ptrs_ = nullptr;
+  uint64_t *proof_lens_ = nullptr;
+  std::string meta_json_;
+};
+
+class SessionOpenWorker : public PromiseWorker {
+ public:
+  SessionOpenWorker(Napi::Env env, CommonConfig config)
+      : PromiseWorker(env), config_(std::move(config)) {}
+
+ protected:
+  void Execute() override {
+    int32_t rc = zkp_init();
+    if (rc != ZKP_OK) {
+      Fail(rc, "zkp_init failed");
+      return;
+    }
+
+    rc = zkp_session_open(config_.backend_id.c_str(), config_.field.c_str(),
+                          config_.hash_id.c_str(), config_.fri_arity, config_.profile_id.c_str(),
+                          config_.air_path.c_str(), &session_);
+    if (rc != ZKP_OK) {
+      Fail(rc, "zkp_session_open failed");
+    }
+  }
+
+  void OnOK() override {
+    Napi::Env env = Env();
+    Resolve(Napi::Number::New(env, static_cast<double>(session_)));
+  }
+
+ private:
+  CommonConfig config_;
+  uint64_t session_ = 0;
+};
+
+class SessionCloseWorker : public PromiseWorker {
+ public:
+  SessionCloseWorker(Napi::Env env, uint64_t session)
+      : PromiseWorker(env), session_(session) {}
+
+ protected:
+  void Execute() override {
+    int32_t rc = zkp_session_close(session_);
+    if (rc != ZKP_OK) {
+      Fail(rc, "zkp_session_close failed");
+    }
+  }
+
+  void OnOK() override { Resolve(Env().Undefined()); }
+
+ private:
+  uint64_t session_ = 0;
 };
 
 Napi::Promise RejectInvalidArg(Napi::Env env, const std::string &detail) {
@@ -523,13 +928,208 @@ Napi::Value Verify(const Napi::CallbackInfo &info) {
   return promise;
 }
 
+Napi::Value ProveBatch(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  if (info.Length() < 2) {
+    return RejectInvalidArg(env, "Expected configuration object and array of public input strings");
+  }
+
+  CommonConfig config;
+  std::string detail;
+  if (!ParseSessionConfig(info[0], &config, &detail)) {
+    return RejectInvalidArg(env, detail);
+  }
+
+  if (!info[1].IsArray()) {
+    return RejectInvalidArg(env, "Public inputs must be an array of strings");
+  }
+
+  Napi::Array array = info[1].As<Napi::Array>();
+  if (array.Length() == 0) {
+    return RejectInvalidArg(env, "Public inputs array must not be empty");
+  }
+
+  std::vector<std::string> inputs;
+  inputs.reserve(array.Length());
+  for (uint32_t i = 0; i < array.Length(); ++i) {
+    Napi::Value entry = array.Get(i);
+    if (!entry.IsString()) {
+      return RejectInvalidArg(env, "Public inputs array entries must be strings");
+    }
+    inputs.push_back(entry.As<Napi::String>().Utf8Value());
+  }
+
+  ProveBatchWorker *worker = new ProveBatchWorker(env, std::move(config), std::move(inputs));
+  Napi::Promise promise = worker->GetPromise();
+  worker->Queue();
+  return promise;
+}
+
+Napi::Value SessionOpen(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  if (info.Length() < 1) {
+    return RejectInvalidArg(env, "Expected session configuration object as first argument");
+  }
+
+  CommonConfig config;
+  std::string detail;
+  if (!ParseSessionConfig(info[0], &config, &detail)) {
+    return RejectInvalidArg(env, detail);
+  }
+
+  SessionOpenWorker *worker = new SessionOpenWorker(env, std::move(config));
+  Napi::Promise promise = worker->GetPromise();
+  worker->Queue();
+  return promise;
+}
+
+Napi::Value SessionProve(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  if (info.Length() < 2) {
+    return RejectInvalidArg(env, "Expected session handle and public inputs JSON string");
+  }
+
+  uint64_t session = 0;
+  std::string detail;
+  if (!ParseSessionHandle(info[0], &session, &detail)) {
+    return RejectInvalidArg(env, detail);
+  }
+
+  if (!info[1].IsString()) {
+    return RejectInvalidArg(env, "Public inputs must be a string");
+  }
+
+  ProveWorker *worker = new ProveWorker(env, session, info[1].As<Napi::String>().Utf8Value());
+  Napi::Promise promise = worker->GetPromise();
+  worker->Queue();
+  return promise;
+}
+
+Napi::Value SessionVerify(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  if (info.Length() < 3) {
+    return RejectInvalidArg(env, "Expected session handle, public inputs JSON, and proof buffer");
+  }
+
+  uint64_t session = 0;
+  std::string detail;
+  if (!ParseSessionHandle(info[0], &session, &detail)) {
+    return RejectInvalidArg(env, detail);
+  }
+
+  if (!info[1].IsString()) {
+    return RejectInvalidArg(env, "Public inputs must be a string");
+  }
+
+  if (!info[2].IsBuffer()) {
+    return RejectInvalidArg(env, "Proof must be a Buffer");
+  }
+
+  Napi::Buffer<uint8_t> proof = info[2].As<Napi::Buffer<uint8_t>>();
+  VerifyWorker *worker =
+      new VerifyWorker(env, session, info[1].As<Napi::String>().Utf8Value(), proof);
+  Napi::Promise promise = worker->GetPromise();
+  worker->Queue();
+  return promise;
+}
+
+bool GetSizeProperty(const Napi::Object &obj, const char *key, size_t current, size_t *out_value,
+                     std::string *detail) {
+  if (!obj.Has(key)) {
+    *out_value = current;
+    return true;
+  }
+  Napi::Value value = obj.Get(key);
+  if (!value.IsNumber()) {
+    *detail = std::string("Property '") + key + "' must be a positive integer";
+    return false;
+  }
+  double number = value.As<Napi::Number>().DoubleValue();
+  if (number < 1.0 || std::floor(number) != number) {
+    *detail = std::string("Property '") + key + "' must be a positive integer";
+    return false;
+  }
+  *out_value = static_cast<size_t>(number);
+  return true;
+}
+
+Napi::Value ConfigurePool(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  if (info.Length() < 1 || !info[0].IsObject()) {
+    Napi::Error::New(env, "Expected options object with 'threads' and/or 'maxInFlight'")
+        .ThrowAsJavaScriptException();
+    return env.Undefined();
+  }
+
+  size_t threads = 0;
+  size_t max_in_flight = 0;
+  size_t in_flight = 0;
+  size_t queued = 0;
+  WorkerPool::Instance().Stats(&threads, &max_in_flight, &in_flight, &queued);
+
+  Napi::Object obj = info[0].As<Napi::Object>();
+  std::string detail;
+  if (!GetSizeProperty(obj, "threads", threads, &threads, &detail) ||
+      !GetSizeProperty(obj, "maxInFlight", max_in_flight, &max_in_flight, &detail)) {
+    Napi::Error::New(env, detail).ThrowAsJavaScriptException();
+    return env.Undefined();
+  }
+
+  if (!WorkerPool::Instance().Configure(threads, max_in_flight, &detail)) {
+    Napi::Error::New(env, detail).ThrowAsJavaScriptException();
+    return env.Undefined();
+  }
+  return env.Undefined();
+}
+
+Napi::Value PoolStats(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  size_t threads = 0;
+  size_t max_in_flight = 0;
+  size_t in_flight = 0;
+  size_t queued = 0;
+  WorkerPool::Instance().Stats(&threads, &max_in_flight, &in_flight, &queued);
+
+  Napi::Object stats = Napi::Object::New(env);
+  stats.Set("threads", Napi::Number::New(env, static_cast<double>(threads)));
+  stats.Set("maxInFlight", Napi::Number::New(env, static_cast<double>(max_in_flight)));
+  stats.Set("inFlight", Napi::Number::New(env, static_cast<double>(in_flight)));
+  stats.Set("queued", Napi::Number::New(env, static_cast<double>(queued)));
+  return stats;
+}
+
+Napi::Value SessionClose(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  if (info.Length() < 1) {
+    return RejectInvalidArg(env, "Expected session handle as first argument");
+  }
+
+  uint64_t session = 0;
+  std::string detail;
+  if (!ParseSessionHandle(info[0], &session, &detail)) {
+    return RejectInvalidArg(env, detail);
+  }
+
+  SessionCloseWorker *worker = new SessionCloseWorker(env, session);
+  Napi::Promise promise = worker->GetPromise();
+  worker->Queue();
+  return promise;
+}
+
 }  // namespace
 
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
   exports.Set("listBackends", Napi::Function::New(env, ListBackends));
   exports.Set("listProfiles", Napi::Function::New(env, ListProfiles));
   exports.Set("prove", Napi::Function::New(env, Prove));
+  exports.Set("proveBatch", Napi::Function::New(env, ProveBatch));
   exports.Set("verify", Napi::Function::New(env, Verify));
+  exports.Set("sessionOpen", Napi::Function::New(env, SessionOpen));
+  exports.Set("sessionProve", Napi::Function::New(env, SessionProve));
+  exports.Set("sessionVerify", Napi::Function::New(env, SessionVerify));
+  exports.Set("sessionClose", Napi::Function::New(env, SessionClose));
+  exports.Set("configurePool", Napi::Function::New(env, ConfigurePool));
+  exports.Set("poolStats", Napi::Function::New(env, PoolStats));
   return exports;
 }
 
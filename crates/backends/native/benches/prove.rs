@@ -0,0 +1,85 @@
+//! End-to-end prove/verify benchmarks per built-in profile, with loud
+//! per-profile time budgets derived from each profile's FRI parameters.
+//!
+//! Run with `cargo bench -p zkprov-backend-native`. After the Criterion
+//! passes, every profile's prove path is re-timed against its budget and the
+//! run panics if the median exceeds it, so a regression fails the bench job
+//! instead of drifting into production unnoticed.
+
+use criterion::{BenchmarkId, Criterion};
+use std::hint::black_box;
+use std::time::{Duration, Instant};
+use zkprov_backend_native::{native_prove, native_verify};
+use zkprov_corelib::config::Config;
+use zkprov_corelib::profile::find_profile;
+
+const AIR: &str = concat!(env!("CARGO_MANIFEST_DIR"), "/../../../examples/air/toy.air");
+const INPUTS: &str = r#"{"bench":1,"values":[1,2,3,4]}"#;
+const PROFILES: [&str; 3] = ["dev-fast", "balanced", "secure"];
+
+fn config_for(profile: &str) -> Config {
+    Config::new("native@0.0", "Prime254", "blake3", 2, false, profile)
+}
+
+/// Wall-time budget for one prove call under a profile. Scaled from the
+/// profile's FRI work factor (blowup x queries) so heavier profiles get
+/// proportionally more headroom; the floor keeps dev-fast from flapping.
+fn prove_budget(profile: &str) -> Duration {
+    let p = find_profile(profile).expect("built-in profile");
+    let work = u64::from(p.fri_blowup.unwrap_or(8)) * u64::from(p.fri_queries.unwrap_or(16));
+    Duration::from_micros((work * 250).max(50_000))
+}
+
+fn bench_prove_verify(c: &mut Criterion) {
+    let mut group = c.benchmark_group("native");
+    for profile in PROFILES {
+        let cfg = config_for(profile);
+        let proof = native_prove(&cfg, INPUTS, AIR).expect("prove");
+        group.bench_with_input(BenchmarkId::new("prove", profile), &cfg, |bencher, cfg| {
+            bencher.iter(|| native_prove(black_box(cfg), black_box(INPUTS), black_box(AIR)))
+        });
+        group.bench_with_input(BenchmarkId::new("verify", profile), &cfg, |bencher, cfg| {
+            bencher.iter(|| {
+                native_verify(
+                    black_box(cfg),
+                    black_box(INPUTS),
+                    black_box(AIR),
+                    black_box(&proof),
+                )
+            })
+        });
+    }
+    group.finish();
+}
+
+/// Median-of-9 budget check per profile; panics loudly on a miss.
+fn enforce_budgets() {
+    for profile in PROFILES {
+        let cfg = config_for(profile);
+        let mut runs: Vec<Duration> = (0..9)
+            .map(|_| {
+                let start = Instant::now();
+                black_box(native_prove(&cfg, INPUTS, AIR).expect("prove"));
+                start.elapsed()
+            })
+            .collect();
+        runs.sort();
+        let median = runs[runs.len() / 2];
+        let budget = prove_budget(profile);
+        if median > budget {
+            panic!(
+                "BUDGET EXCEEDED: native_prove under '{profile}' took {median:?} (median of 9), budget {budget:?}"
+            );
+        }
+        eprintln!("budget ok: '{profile}' median {median:?} within {budget:?}");
+    }
+}
+
+// Custom harness instead of criterion_main! so the budget check runs after
+// the measurement passes and can fail the bench job.
+fn main() {
+    let mut criterion = Criterion::default().configure_from_args();
+    bench_prove_verify(&mut criterion);
+    criterion.final_summary();
+    enforce_budgets();
+}
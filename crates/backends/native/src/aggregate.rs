@@ -0,0 +1,197 @@
+//! Leaf-proof aggregation: verify N proofs in parallel, then fold them into
+//! one aggregate proof whose verification cost is independent of N.
+//!
+//! The fold is a Phase-0 placeholder for the recursion circuit — a chained
+//! digest over the leaf proofs in order — but the engine shape (parallel leaf
+//! verification feeding a sequential fold, one aggregate header out) is the
+//! one the real circuit slots into.
+
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::Mutex;
+
+use zkprov_corelib::air::AirProgram;
+use zkprov_corelib::config::Config;
+use zkprov_corelib::proof;
+
+use crate::{native_verify_prepared, prove_threads};
+
+/// Domain label for the aggregate proof body.
+const AGG_BODY_LABEL: &str = "AGG/NODE";
+
+/// Verify one `(public_inputs_json, proof)` leaf, naming its index on
+/// failure.
+fn verify_leaf(
+    config: &Config,
+    air: &AirProgram,
+    index: usize,
+    inputs: &str,
+    proof: &[u8],
+) -> anyhow::Result<()> {
+    match native_verify_prepared(config, inputs, air, proof) {
+        Ok(true) => Ok(()),
+        Ok(false) => anyhow::bail!("leaf proof {} failed verification", index),
+        Err(e) => anyhow::bail!("leaf proof {}: {}", index, e),
+    }
+}
+
+/// Verify every leaf against `air`, fanned out across scoped worker threads
+/// up to the profile's thread cap. The leaves get their own threads rather
+/// than the backend pool because each verify call fans out through the pool
+/// itself. Fails on the first invalid or malformed leaf (lowest index).
+fn verify_leaves(
+    config: &Config,
+    air: &AirProgram,
+    leaves: &[(&str, &[u8])],
+) -> anyhow::Result<()> {
+    let threads = prove_threads(config).clamp(1, leaves.len().max(1));
+    if threads <= 1 || leaves.len() <= 1 {
+        for (index, (inputs, proof)) in leaves.iter().enumerate() {
+            verify_leaf(config, air, index, inputs, proof)?;
+        }
+        return Ok(());
+    }
+
+    let next = AtomicUsize::new(0);
+    let results: Vec<Mutex<Option<anyhow::Result<()>>>> =
+        leaves.iter().map(|_| Mutex::new(None)).collect();
+    std::thread::scope(|scope| {
+        for _ in 0..threads {
+            scope.spawn(|| loop {
+                let i = next.fetch_add(1, Ordering::Relaxed);
+                if i >= leaves.len() {
+                    break;
+                }
+                let (inputs, proof) = leaves[i];
+                let result = verify_leaf(config, air, i, inputs, proof);
+                if let Ok(mut slot) = results[i].lock() {
+                    *slot = Some(result);
+                }
+            });
+        }
+    });
+    for (index, slot) in results.into_iter().enumerate() {
+        slot.into_inner()
+            .ok()
+            .flatten()
+            .unwrap_or_else(|| Err(anyhow::anyhow!("leaf proof {}: verify worker panicked", index)))?;
+    }
+    Ok(())
+}
+
+/// Chained digest over the leaf proofs in order (order matters: swapping two
+/// leaves changes the aggregate).
+fn fold_leaves(leaves: &[(&str, &[u8])]) -> u64 {
+    let mut acc = proof::hash64("AGG/INIT", &(leaves.len() as u64).to_le_bytes());
+    for (_, leaf) in leaves {
+        let mut node = Vec::with_capacity(8 + leaf.len());
+        node.extend_from_slice(&acc.to_le_bytes());
+        node.extend_from_slice(leaf);
+        acc = proof::hash64(AGG_BODY_LABEL, &node);
+    }
+    acc
+}
+
+/// Public IO of the aggregate: the leaf public-input strings, in order.
+fn aggregate_pubio_hash(leaves: &[(&str, &[u8])]) -> u64 {
+    let mut buf = Vec::new();
+    for (inputs, _) in leaves {
+        buf.extend_from_slice(&(inputs.len() as u64).to_le_bytes());
+        buf.extend_from_slice(inputs.as_bytes());
+    }
+    proof::hash64("AGG/PUBIO", &buf)
+}
+
+/// Aggregate `leaves` — `(public_inputs_json, proof_bytes)` pairs proved
+/// against one `air` under one `config` — into a single proof.
+///
+/// Every leaf is verified first (in parallel); the aggregate body is the
+/// 16-byte `(count, fold)` result of the placeholder recursion fold.
+pub fn native_aggregate(
+    config: &Config,
+    air: &AirProgram,
+    leaves: &[(&str, &[u8])],
+) -> anyhow::Result<Vec<u8>> {
+    if leaves.is_empty() {
+        anyhow::bail!("aggregation requires at least one leaf proof");
+    }
+    verify_leaves(config, air, leaves)?;
+
+    let mut body = Vec::with_capacity(16);
+    body.extend_from_slice(&(leaves.len() as u64).to_le_bytes());
+    body.extend_from_slice(&fold_leaves(leaves).to_le_bytes());
+
+    let header = proof::ProofHeader {
+        backend_id_hash: proof::hash64("BACKEND", config.backend_id.as_bytes()),
+        profile_id_hash: proof::hash64("PROFILE", config.profile_id.as_bytes()),
+        pubio_hash: aggregate_pubio_hash(leaves),
+        body_len: body.len() as u64,
+    };
+    Ok(proof::assemble_proof(&header, &body))
+}
+
+/// Verify an aggregate proof by recomputing it from the same leaves: checks
+/// the header identifiers, the leaf count, and the fold, re-verifying every
+/// leaf along the way.
+pub fn native_verify_aggregate(
+    config: &Config,
+    air: &AirProgram,
+    leaves: &[(&str, &[u8])],
+    aggregate: &[u8],
+) -> anyhow::Result<bool> {
+    let expected = native_aggregate(config, air, leaves)?;
+    Ok(expected == aggregate)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::native_prove_prepared;
+    use crate::tests::toy_air;
+
+    fn config() -> Config {
+        Config::new("native@0.0", "Prime254", "blake3", 2, false, "balanced")
+    }
+
+    #[test]
+    fn aggregate_roundtrip_and_order_sensitivity() {
+        zkprov_corelib::registry::ensure_builtins_registered();
+        let config = config();
+        let air = toy_air();
+        let inputs: Vec<String> = (0..4).map(|n| format!(r#"{{"n":{n}}}"#)).collect();
+        let proofs: Vec<Vec<u8>> = inputs
+            .iter()
+            .map(|io| native_prove_prepared(&config, io, &air).expect("prove"))
+            .collect();
+        let leaves: Vec<(&str, &[u8])> = inputs
+            .iter()
+            .zip(&proofs)
+            .map(|(io, p)| (io.as_str(), p.as_slice()))
+            .collect();
+
+        let agg = native_aggregate(&config, &air, &leaves).expect("aggregate");
+        assert!(native_verify_aggregate(&config, &air, &leaves, &agg).expect("verify"));
+
+        // Aggregate size is independent of N: same header + 16-byte body.
+        assert_eq!(agg.len(), 40 + 16);
+
+        // Swapping two leaves changes the fold.
+        let mut swapped = leaves.clone();
+        swapped.swap(0, 1);
+        assert!(!native_verify_aggregate(&config, &air, &swapped, &agg).expect("verify swapped"));
+    }
+
+    #[test]
+    fn aggregate_rejects_bad_leaf() {
+        zkprov_corelib::registry::ensure_builtins_registered();
+        let config = config();
+        let air = toy_air();
+        let io = r#"{"n":1}"#;
+        let mut proof = native_prove_prepared(&config, io, &air).expect("prove");
+        let last = proof.len() - 1;
+        proof[last] ^= 0xFF;
+        let leaves: Vec<(&str, &[u8])> = vec![(io, proof.as_slice())];
+        let err = native_aggregate(&config, &air, &leaves).unwrap_err().to_string();
+        assert!(err.contains("leaf proof 0"), "{err}");
+        assert!(native_aggregate(&config, &air, &[]).is_err());
+    }
+}
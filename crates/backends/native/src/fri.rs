@@ -0,0 +1,194 @@
+//! FRI commit/fold pipeline for the native backend.
+//!
+//! Implements the layer-folding half of FRI over [`Fp254`]: a codeword is
+//! repeatedly folded by a Fiat-Shamir challenge (arity 2 or 4, matching the
+//! capabilities advertised by `NativeBackend`) and every layer is committed
+//! with an arity-2 Merkle tree over the element encodings. Folding walks the
+//! codeword in chunks sized to stay inside L2 cache so the pass is
+//! memory-bandwidth-bound instead of pointer-chasing. The stub prover does
+//! not call this yet; proof bytes are unchanged until the stub is retired.
+
+use zkprov_corelib::crypto::fp254::Fp254;
+use zkprov_corelib::crypto::hash::{hash_labeled, Hash32};
+use zkprov_corelib::crypto::merkle::MerkleTree2;
+
+/// Elements folded per pass: 8192 × 32 bytes = 256 KiB of input, which with
+/// the folded output still fits a typical 512 KiB+ L2 slice.
+const FOLD_CHUNK: usize = 1 << 13;
+
+/// Commitment to a full FRI folding schedule: one Merkle root per folded
+/// layer (largest first) plus the final layer sent in the clear.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct FriCommitment {
+    pub arity: usize,
+    pub layer_roots: Vec<[u8; 32]>,
+    pub final_layer: Vec<Fp254>,
+}
+
+/// Fold an arity-2 layer: `out[i] = cw[2i] + beta * cw[2i+1]`.
+///
+/// The codeword length must be a multiple of 2; [`commit`] pads up front.
+pub fn fold_arity2(codeword: &[Fp254], beta: Fp254) -> Vec<Fp254> {
+    assert!(codeword.len() % 2 == 0, "arity-2 fold needs even length");
+    let mut out = Vec::with_capacity(codeword.len() / 2);
+    for chunk in codeword.chunks(FOLD_CHUNK) {
+        for pair in chunk.chunks_exact(2) {
+            out.push(pair[0] + beta * pair[1]);
+        }
+    }
+    out
+}
+
+/// Fold an arity-4 layer:
+/// `out[i] = cw[4i] + beta*cw[4i+1] + beta^2*cw[4i+2] + beta^3*cw[4i+3]`.
+///
+/// Beta powers are hoisted out of the loop and each group is combined with
+/// independent multiplies, so the body is straight-line arithmetic a SIMD
+/// field kernel can replace without changing outputs.
+pub fn fold_arity4(codeword: &[Fp254], beta: Fp254) -> Vec<Fp254> {
+    assert!(
+        codeword.len() % 4 == 0,
+        "arity-4 fold needs length divisible by 4"
+    );
+    let beta2 = beta.square();
+    let beta3 = beta2 * beta;
+    let mut out = Vec::with_capacity(codeword.len() / 4);
+    for chunk in codeword.chunks(FOLD_CHUNK) {
+        for group in chunk.chunks_exact(4) {
+            let t1 = beta * group[1];
+            let t2 = beta2 * group[2];
+            let t3 = beta3 * group[3];
+            out.push(group[0] + t1 + t2 + t3);
+        }
+    }
+    out
+}
+
+/// Fold one layer at the given arity (2 or 4).
+pub fn fold_layer(codeword: &[Fp254], beta: Fp254, arity: usize) -> anyhow::Result<Vec<Fp254>> {
+    match arity {
+        2 => Ok(fold_arity2(codeword, beta)),
+        4 => Ok(fold_arity4(codeword, beta)),
+        other => anyhow::bail!("unsupported FRI arity {}", other),
+    }
+}
+
+/// Merkle root over the big-endian encodings of one layer's elements.
+fn layer_root<H: Hash32>(layer: &[Fp254]) -> [u8; 32] {
+    let encoded: Vec<[u8; 32]> = layer.iter().map(|e| e.to_bytes_be()).collect();
+    let refs: Vec<&[u8]> = encoded.iter().map(|e| e.as_slice()).collect();
+    MerkleTree2::build::<H>(&refs).root()
+}
+
+/// Fiat-Shamir challenge for the next fold, bound to the layer root and its
+/// position in the schedule.
+fn layer_beta<H: Hash32>(root: &[u8; 32], layer_index: usize) -> Fp254 {
+    let mut transcript = [0u8; 40];
+    transcript[..32].copy_from_slice(root);
+    transcript[32..].copy_from_slice(&(layer_index as u64).to_le_bytes());
+    Fp254::from_bytes32_be(&hash_labeled::<H>("FRI/BETA", &transcript))
+}
+
+/// Commit to the full folding schedule of `codeword`.
+///
+/// The codeword is zero-padded to a power of the arity, then folded until at
+/// most `final_len` elements remain; each layer contributes its Merkle root,
+/// and the challenge for every fold is derived from the root it follows.
+pub fn commit<H: Hash32>(
+    codeword: &[Fp254],
+    arity: usize,
+    final_len: usize,
+) -> anyhow::Result<FriCommitment> {
+    if !matches!(arity, 2 | 4) {
+        anyhow::bail!("unsupported FRI arity {}", arity);
+    }
+    if codeword.is_empty() {
+        anyhow::bail!("empty codeword");
+    }
+    let final_len = final_len.max(1);
+
+    let mut padded = codeword.len().next_power_of_two();
+    if arity == 4 && padded.trailing_zeros() % 2 != 0 {
+        padded <<= 1; // arity 4 needs an even power of two
+    }
+    let mut layer = codeword.to_vec();
+    layer.resize(padded, Fp254::zero());
+
+    let mut layer_roots = Vec::new();
+    while layer.len() > final_len {
+        let root = layer_root::<H>(&layer);
+        let beta = layer_beta::<H>(&root, layer_roots.len());
+        layer_roots.push(root);
+        layer = fold_layer(&layer, beta, arity)?;
+    }
+
+    Ok(FriCommitment {
+        arity,
+        layer_roots,
+        final_layer: layer,
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use zkprov_corelib::crypto::blake3::Blake3;
+
+    fn codeword(n: usize) -> Vec<Fp254> {
+        (0..n)
+            .map(|i| Fp254::from_u64(i as u64 + 1).square())
+            .collect()
+    }
+
+    #[test]
+    fn fold_halves_and_quarters_length() {
+        let cw = codeword(64);
+        let beta = Fp254::from_u64(7);
+        assert_eq!(fold_arity2(&cw, beta).len(), 32);
+        assert_eq!(fold_arity4(&cw, beta).len(), 16);
+    }
+
+    #[test]
+    fn arity4_fold_equals_two_arity2_folds() {
+        // Folding by beta then beta^2 at arity 2 is the same linear
+        // combination as one arity-4 fold by beta.
+        let cw = codeword(256);
+        let beta = Fp254::from_u64(0x1234_5678_9abc_def0);
+        let two_step = fold_arity2(&fold_arity2(&cw, beta), beta.square());
+        assert_eq!(fold_arity4(&cw, beta), two_step);
+    }
+
+    #[test]
+    fn fold_is_chunk_invariant() {
+        // Crossing FOLD_CHUNK must not change results.
+        let cw = codeword(FOLD_CHUNK * 2 + 8);
+        let beta = Fp254::from_u64(3);
+        let whole = fold_arity2(&cw, beta);
+        let mut pieces = fold_arity2(&cw[..FOLD_CHUNK], beta);
+        pieces.extend(fold_arity2(&cw[FOLD_CHUNK..], beta));
+        assert_eq!(whole, pieces);
+    }
+
+    #[test]
+    fn commit_schedule_is_deterministic_and_terminates() {
+        let cw = codeword(100); // pads to 128 (arity 2) or 256 (arity 4)
+        for arity in [2usize, 4] {
+            let c1 = commit::<Blake3>(&cw, arity, 4).unwrap();
+            let c2 = commit::<Blake3>(&cw, arity, 4).unwrap();
+            assert_eq!(c1, c2);
+            assert!(c1.final_layer.len() <= 4);
+            assert!(!c1.layer_roots.is_empty());
+        }
+        // Different arities commit to different schedules.
+        let r2 = commit::<Blake3>(&cw, 2, 4).unwrap();
+        let r4 = commit::<Blake3>(&cw, 4, 4).unwrap();
+        assert_ne!(r2.layer_roots[0], r4.layer_roots[0]);
+        assert_ne!(r2.final_layer, r4.final_layer);
+    }
+
+    #[test]
+    fn commit_rejects_bad_inputs() {
+        assert!(commit::<Blake3>(&[], 2, 4).is_err());
+        assert!(commit::<Blake3>(&codeword(8), 3, 4).is_err());
+    }
+}
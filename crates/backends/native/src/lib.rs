@@ -1,8 +1,12 @@
 //! Native backend adapter with AIR-aware stub proving and hash selection.
 
+pub mod aggregate;
+pub mod fri;
+pub mod pool;
+
 use zkprov_corelib::air::AirProgram;
 use zkprov_corelib::backend::{Capabilities, ProverBackend, VerifierBackend};
-use zkprov_corelib::crypto::registry::hash64_by_id;
+use zkprov_corelib::crypto::registry::HashId;
 use zkprov_corelib::errors::RegistryError;
 use zkprov_corelib::registry::register_backend;
 use zkprov_corelib::trace::TraceShape;
@@ -24,8 +28,8 @@ impl ProverBackend for NativeBackend {
             fields: vec!["Prime254"],
             hashes: vec!["blake3", "keccak256", "poseidon2", "rescue"],
             fri_arities: vec![2, 4],
-            recursion: "none",
-            lookups: false,
+            recursion: "stark-in-stark",
+            lookups: true,
             curves: vec!["placeholder"],
             pedersen: true,
         }
@@ -44,56 +48,227 @@ pub fn register_native_backend() -> Result<(), RegistryError> {
     register_backend(Box::new(NativeBackend), Box::new(NativeBackend))
 }
 
+/// Mixed contribution of one labeled segment to the fake trace root.
+fn mix_segment(hash_id: HashId, label: &str, bytes: &[u8]) -> u64 {
+    let h = hash_id.hash64(label, bytes);
+    h.rotate_left(13) ^ h.wrapping_mul(0x9e3779b97f4a7c15)
+}
+
 /// Deterministic root over AIR+Trace+Inputs using selected hash (64-bit).
-fn fake_trace_root_u64(air: &AirProgram, inputs_json: &str, hash_id: &str) -> anyhow::Result<u64> {
-    // Mix in salient fields; order matters (stable).
-    let mut accum = 0u64;
-    let mix = |acc: &mut u64, label: &str, bytes: &[u8]| -> anyhow::Result<()> {
-        let h = hash64_by_id(hash_id, label, bytes)
-            .ok_or_else(|| anyhow::anyhow!("unsupported hash id '{}'", hash_id))?;
-        *acc ^= h.rotate_left(13) ^ h.wrapping_mul(0x9e3779b97f4a7c15);
-        Ok(())
-    };
-    let shape = TraceShape::from_air(air);
+///
+/// Segment contributions combine with XOR, which commutes, so splitting the
+/// segments across the backend pool cannot change the digest — the result is
+/// identical for any thread count.
+fn fake_trace_root_u64(
+    air: &AirProgram,
+    shape: &TraceShape,
+    inputs_json: &str,
+    hash_id: &str,
+    threads: usize,
+) -> anyhow::Result<u64> {
+    // Resolve the hash id once; segments dispatch through the interned enum.
+    let hash_id = HashId::resolve(hash_id)
+        .ok_or_else(|| anyhow::anyhow!("unsupported hash id '{}'", hash_id))?;
+    let segments: Vec<(&'static str, Vec<u8>)> = vec![
+        ("AIR.NAME", air.meta.name.as_bytes().to_vec()),
+        ("AIR.FIELD", air.meta.field.as_bytes().to_vec()),
+        ("TRACE.ROWS", shape.rows.to_le_bytes().to_vec()),
+        ("TRACE.COLS", shape.cols.to_le_bytes().to_vec()),
+        ("IO.JSON", inputs_json.as_bytes().to_vec()),
+    ];
+
+    if threads <= 1 || segments.len() <= 1 {
+        let mut accum = 0u64;
+        for (label, bytes) in &segments {
+            accum ^= mix_segment(hash_id, label, bytes);
+        }
+        return Ok(accum);
+    }
 
-    mix(&mut accum, "AIR.NAME", air.meta.name.as_bytes())?;
-    mix(&mut accum, "AIR.FIELD", air.meta.field.as_bytes())?;
-    mix(&mut accum, "TRACE.ROWS", &shape.rows.to_le_bytes())?;
-    mix(&mut accum, "TRACE.COLS", &shape.cols.to_le_bytes())?;
-    mix(&mut accum, "IO.JSON", inputs_json.as_bytes())?;
+    let per_job = segments.len().div_ceil(threads.min(segments.len()));
+    let mut chunks: Vec<Vec<(&'static str, Vec<u8>)>> = Vec::new();
+    let mut rest = segments;
+    while !rest.is_empty() {
+        let tail = rest.split_off(per_job.min(rest.len()));
+        chunks.push(rest);
+        rest = tail;
+    }
+    let jobs: Vec<_> = chunks
+        .into_iter()
+        .map(|chunk| {
+            move || -> u64 {
+                let mut accum = 0u64;
+                for (label, bytes) in &chunk {
+                    accum ^= mix_segment(hash_id, label, bytes);
+                }
+                accum
+            }
+        })
+        .collect();
 
+    let mut accum = 0u64;
+    for partial in pool::run_all(jobs) {
+        accum ^= partial;
+    }
     Ok(accum)
 }
 
+/// Worker threads the prove path may use: the config's profile cap when one
+/// is set, otherwise all available cores.
+pub(crate) fn prove_threads(config: &Config) -> usize {
+    zkprov_corelib::profile::find_profile(&config.profile_id)
+        .map(|p| p.effective_threads())
+        .unwrap_or_else(|| pool::global().threads())
+}
+
+/// Per-stage wall times of one prove call, in microseconds. Stages the call
+/// skipped (e.g. load/validate on the prepared path) stay zero.
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq)]
+pub struct StageTimings {
+    pub load_micros: u64,
+    pub validate_micros: u64,
+    pub trace_shape_micros: u64,
+    pub commit_micros: u64,
+    pub encode_micros: u64,
+}
+
+/// Start a stage span: one clock read, only when timings are collected.
+fn span_start(enabled: bool) -> Option<std::time::Instant> {
+    enabled.then(std::time::Instant::now)
+}
+
+/// Close a stage span into `slot`: the second clock read.
+fn span_end(slot: &mut u64, start: Option<std::time::Instant>) {
+    if let Some(start) = start {
+        *slot = start.elapsed().as_micros() as u64;
+    }
+}
+
 /// Prove: AIR-aware deterministic proof.
 pub fn native_prove(
     config: &Config,
     public_inputs_json: &str,
     air_path: &str,
 ) -> anyhow::Result<Vec<u8>> {
+    native_prove_timed(config, public_inputs_json, air_path).map(|(proof, _)| proof)
+}
+
+/// Prove with per-stage timings when `config.collect_timings` is set;
+/// otherwise identical to [`native_prove`] with no clock reads on the hot
+/// path.
+pub fn native_prove_timed(
+    config: &Config,
+    public_inputs_json: &str,
+    air_path: &str,
+) -> anyhow::Result<(Vec<u8>, Option<StageTimings>)> {
     zkprov_corelib::registry::ensure_builtins_registered();
+    let enabled = config.collect_timings;
+    let mut timings = StageTimings::default();
+
+    let span = span_start(enabled);
     validate_config(config)?;
+    span_end(&mut timings.validate_micros, span);
 
-    // Load and validate AIR
+    let span = span_start(enabled);
     let air = AirProgram::load_from_file(air_path)?;
+    span_end(&mut timings.load_micros, span);
+
+    let span = span_start(enabled);
     validate_air_against_backend(&air, &config.backend_id)?;
+    if let Some(start) = span {
+        timings.validate_micros += start.elapsed().as_micros() as u64;
+    }
 
-    // Header identifiers
-    let backend_id_hash = proof::hash64("BACKEND", config.backend_id.as_bytes());
-    let profile_id_hash = proof::hash64("PROFILE", config.profile_id.as_bytes());
-    let pubio_hash = proof::hash64("PUBIO", public_inputs_json.as_bytes());
+    let proof = prove_prepared_impl(config, public_inputs_json, &air, enabled, &mut timings)?;
+    Ok((proof, enabled.then_some(timings)))
+}
+
+/// Prove against an already-loaded AIR program.
+///
+/// Skips config and AIR validation; callers (e.g. FFI session handles) are
+/// expected to have validated both when the AIR was loaded.
+pub fn native_prove_prepared(
+    config: &Config,
+    public_inputs_json: &str,
+    air: &AirProgram,
+) -> anyhow::Result<Vec<u8>> {
+    let mut timings = StageTimings::default();
+    prove_prepared_impl(config, public_inputs_json, air, false, &mut timings)
+}
+
+/// Prepared-path prove with timings when `config.collect_timings` is set;
+/// load/validate spans stay zero because this path skips both stages.
+pub fn native_prove_prepared_timed(
+    config: &Config,
+    public_inputs_json: &str,
+    air: &AirProgram,
+) -> anyhow::Result<(Vec<u8>, Option<StageTimings>)> {
+    let enabled = config.collect_timings;
+    let mut timings = StageTimings::default();
+    let proof = prove_prepared_impl(config, public_inputs_json, air, enabled, &mut timings)?;
+    Ok((proof, enabled.then_some(timings)))
+}
+
+/// Fail fast when the projected trace for `shape` would blow the profile's
+/// memory cap, before any arena is allocated. Profiles without a cap (and
+/// unknown profile ids) pass through.
+fn check_memory_budget(config: &Config, shape: &TraceShape) -> anyhow::Result<()> {
+    let Some(profile) = zkprov_corelib::profile::find_profile(&config.profile_id) else {
+        return Ok(());
+    };
+    let Some(budget) = profile.memory_budget_bytes() else {
+        return Ok(());
+    };
+    let projected = shape.projected_bytes();
+    if projected > budget {
+        anyhow::bail!(
+            "projected trace size {} bytes ({} rows x {} cols) exceeds profile '{}' memory cap of {} MiB; \
+             reduce rows_hint or pick a profile with a larger max_memory_mib",
+            projected,
+            shape.rows,
+            shape.total_cols(),
+            profile.id,
+            profile.max_memory_mib.unwrap_or(0),
+        );
+    }
+    Ok(())
+}
+
+fn prove_prepared_impl(
+    config: &Config,
+    public_inputs_json: &str,
+    air: &AirProgram,
+    timings_enabled: bool,
+    timings: &mut StageTimings,
+) -> anyhow::Result<Vec<u8>> {
+    let span = span_start(timings_enabled);
+    let shape = TraceShape::from_air(air);
+    check_memory_budget(config, &shape)?;
+    span_end(&mut timings.trace_shape_micros, span);
 
     // Body = fake trace root as 8 bytes, using user-selected hash
-    let root = fake_trace_root_u64(&air, public_inputs_json, &config.hash)?;
+    let span = span_start(timings_enabled);
+    let root = fake_trace_root_u64(
+        air,
+        &shape,
+        public_inputs_json,
+        &config.hash,
+        prove_threads(config),
+    )?;
     let body = root.to_le_bytes();
+    span_end(&mut timings.commit_micros, span);
 
+    // Header identifiers + final encoding
+    let span = span_start(timings_enabled);
     let header = proof::ProofHeader {
-        backend_id_hash,
-        profile_id_hash,
-        pubio_hash,
+        backend_id_hash: proof::hash64("BACKEND", config.backend_id.as_bytes()),
+        profile_id_hash: proof::hash64("PROFILE", config.profile_id.as_bytes()),
+        pubio_hash: proof::hash64("PUBIO", public_inputs_json.as_bytes()),
         body_len: body.len() as u64,
     };
-    Ok(proof::assemble_proof(&header, &body))
+    let proof = proof::assemble_proof(&header, &body);
+    span_end(&mut timings.encode_micros, span);
+    Ok(proof)
 }
 
 /// Verify: recompute fake root and compare bytes.
@@ -109,6 +284,19 @@ pub fn native_verify(
     let air = AirProgram::load_from_file(air_path)?;
     validate_air_against_backend(&air, &config.backend_id)?;
 
+    native_verify_prepared(config, public_inputs_json, &air, proof_bytes)
+}
+
+/// Verify against an already-loaded AIR program.
+///
+/// Skips config and AIR validation; callers (e.g. FFI session handles) are
+/// expected to have validated both when the AIR was loaded.
+pub fn native_verify_prepared(
+    config: &Config,
+    public_inputs_json: &str,
+    air: &AirProgram,
+    proof_bytes: &[u8],
+) -> anyhow::Result<bool> {
     if proof_bytes.len() < 40 {
         anyhow::bail!("proof too short");
     }
@@ -134,9 +322,79 @@ pub fn native_verify(
     }
 
     // Check fake root derived from selected hash
-    let expect_root = fake_trace_root_u64(&air, public_inputs_json, &config.hash)?.to_le_bytes();
+    let shape = TraceShape::from_air(air);
+    let expect_root = fake_trace_root_u64(
+        air,
+        &shape,
+        public_inputs_json,
+        &config.hash,
+        prove_threads(config),
+    )?
+    .to_le_bytes();
     if body != expect_root {
         anyhow::bail!("fake trace root mismatch");
     }
     Ok(true)
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    const TOY_AIR_TOML: &str = r#"rows_hint = 1024
+
+[meta]
+name = "pool_toy"
+field = "Prime254"
+hash = "blake3"
+
+[columns]
+trace_cols = 4
+const_cols = 0
+periodic_cols = 0
+
+[constraints]
+transition_count = 1
+boundary_count = 1
+"#;
+
+    pub(crate) fn toy_air() -> AirProgram {
+        let tmp = tempfile::NamedTempFile::new().unwrap();
+        std::fs::write(tmp.path(), TOY_AIR_TOML).unwrap();
+        AirProgram::load_from_file(tmp.path()).unwrap()
+    }
+
+    #[test]
+    fn fake_root_is_thread_count_independent() {
+        let air = toy_air();
+        let shape = TraceShape::from_air(&air);
+        let inputs = r#"{"a":7}"#;
+        let serial = fake_trace_root_u64(&air, &shape, inputs, "blake3", 1).unwrap();
+        for threads in [2usize, 4, 16] {
+            assert_eq!(
+                fake_trace_root_u64(&air, &shape, inputs, "blake3", threads).unwrap(),
+                serial
+            );
+        }
+    }
+
+    #[test]
+    fn timings_gated_by_config_flag() {
+        let tmp = tempfile::NamedTempFile::new().unwrap();
+        std::fs::write(tmp.path(), TOY_AIR_TOML).unwrap();
+        let path = tmp.path().to_str().unwrap();
+        let inputs = r#"{"a":7}"#;
+
+        let cfg = crate::Config::new("native@0.0", "Prime254", "blake3", 2, false, "balanced");
+        let (proof, timings) = native_prove_timed(&cfg, inputs, path).unwrap();
+        assert!(timings.is_none());
+
+        let cfg = cfg.with_timings(true);
+        let (timed_proof, timings) = native_prove_timed(&cfg, inputs, path).unwrap();
+        assert_eq!(proof, timed_proof, "timings must not change proof bytes");
+        let timings = timings.unwrap();
+        // Load of a real file always takes measurable time; skipped stages
+        // would only be nonzero on the non-prepared path.
+        assert!(timings.load_micros > 0 || timings.commit_micros > 0);
+    }
+}
@@ -0,0 +1,153 @@
+//! Backend-owned worker pool for prove-path parallelism.
+//!
+//! One pool is spawned lazily per process, sized to the available cores;
+//! profiles control how much of it a given prove call uses by limiting how
+//! many jobs the call submits (see [`Profile::effective_threads`]). Jobs own
+//! their inputs and report results over a channel, so callers never block
+//! workers on shared state.
+//!
+//! [`Profile::effective_threads`]: zkprov_corelib::profile::Profile::effective_threads
+
+use std::cell::Cell;
+use std::sync::mpsc;
+use std::sync::{Arc, Mutex, OnceLock};
+
+type Job = Box<dyn FnOnce() + Send + 'static>;
+
+thread_local! {
+    // True on pool worker threads. A nested [`run_all`] from a worker must
+    // run inline: queueing sub-jobs and blocking on their results deadlocks
+    // once every worker is occupied by an outer job doing the same.
+    static IN_WORKER: Cell<bool> = const { Cell::new(false) };
+}
+
+pub struct NativePool {
+    tx: Mutex<mpsc::Sender<Job>>,
+    threads: usize,
+}
+
+impl NativePool {
+    fn spawn(threads: usize) -> Self {
+        let (tx, rx) = mpsc::channel::<Job>();
+        let rx = Arc::new(Mutex::new(rx));
+        for _ in 0..threads {
+            let rx = Arc::clone(&rx);
+            std::thread::spawn(move || {
+                IN_WORKER.with(|flag| flag.set(true));
+                loop {
+                    let job = match rx.lock() {
+                        Ok(guard) => guard.recv(),
+                        Err(_) => break,
+                    };
+                    match job {
+                        Ok(job) => job(),
+                        Err(_) => break, // sender dropped: process shutdown
+                    }
+                }
+            });
+        }
+        Self {
+            tx: Mutex::new(tx),
+            threads: threads.max(1),
+        }
+    }
+
+    /// Worker threads owned by the pool.
+    pub fn threads(&self) -> usize {
+        self.threads
+    }
+
+    fn execute(&self, job: Job) {
+        self.tx
+            .lock()
+            .expect("native pool sender poisoned")
+            .send(job)
+            .expect("native pool workers alive");
+    }
+}
+
+/// Process-wide pool, spawned on first use with one worker per core. wasm
+/// targets spawn no workers — thread creation traps there — and report one
+/// thread; [`run_all`] executes inline on them.
+pub fn global() -> &'static NativePool {
+    static POOL: OnceLock<NativePool> = OnceLock::new();
+    POOL.get_or_init(|| {
+        if cfg!(target_family = "wasm") {
+            return NativePool::spawn(0);
+        }
+        let cores = std::thread::available_parallelism()
+            .map(|n| n.get())
+            .unwrap_or(1);
+        NativePool::spawn(cores)
+    })
+}
+
+/// Run every job on the pool and collect results in submission order.
+///
+/// Callers enforce a profile's thread cap by batching their work into at
+/// most that many jobs before calling this. Reentrant: a call made from a
+/// pool worker executes its jobs inline rather than queueing them.
+pub fn run_all<T, F>(jobs: Vec<F>) -> Vec<T>
+where
+    F: FnOnce() -> T + Send + 'static,
+    T: Send + 'static,
+{
+    let count = jobs.len();
+    if count <= 1 || cfg!(target_family = "wasm") || IN_WORKER.with(Cell::get) {
+        return jobs.into_iter().map(|job| job()).collect();
+    }
+    let pool = global();
+    let (tx, rx) = mpsc::channel();
+    for (index, job) in jobs.into_iter().enumerate() {
+        let tx = tx.clone();
+        pool.execute(Box::new(move || {
+            let _ = tx.send((index, job()));
+        }));
+    }
+    drop(tx);
+    let mut out: Vec<Option<T>> = (0..count).map(|_| None).collect();
+    for (index, value) in rx {
+        out[index] = Some(value);
+    }
+    out.into_iter()
+        .map(|v| v.expect("native pool job completed"))
+        .collect()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn run_all_keeps_submission_order() {
+        let jobs: Vec<_> = (0..16u64).map(|i| move || i * i).collect();
+        assert_eq!(
+            run_all(jobs),
+            (0..16u64).map(|i| i * i).collect::<Vec<_>>()
+        );
+    }
+
+    #[test]
+    fn pool_has_at_least_one_worker() {
+        assert!(global().threads() >= 1);
+    }
+
+    #[test]
+    fn run_all_nests_without_deadlocking() {
+        // Outer jobs fan out again from inside the pool; without the
+        // worker-context inline path this deadlocks as soon as outer jobs
+        // occupy every worker.
+        let outer: Vec<_> = (0..4u64)
+            .map(|i| {
+                move || {
+                    let inner: Vec<_> = (0..4u64).map(move |j| move || i * 10 + j).collect();
+                    run_all(inner).into_iter().sum::<u64>()
+                }
+            })
+            .collect();
+        let want: Vec<u64> = (0..4u64)
+            .map(|i| (0..4u64).map(|j| i * 10 + j).sum())
+            .collect();
+        assert_eq!(run_all(outer), want);
+    }
+}
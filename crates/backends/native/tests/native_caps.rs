@@ -1,9 +1,9 @@
 use zkprov_corelib::registry::{ensure_builtins_registered, list_backend_infos};
 
 #[test]
-fn native_recursion_flag_false() {
+fn native_recursion_flag_true() {
     ensure_builtins_registered();
     let infos = list_backend_infos();
     let native = infos.iter().find(|b| b.id == "native@0.0").unwrap();
-    assert!(!native.recursion);
+    assert!(native.recursion);
 }
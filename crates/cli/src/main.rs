@@ -4,7 +4,10 @@ use std::convert::TryFrom;
 use std::fs;
 use std::path::Path;
 use std::process;
-use zkprov_backend_native::{native_prove, native_verify};
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::Mutex;
+use zkprov_backend_native::aggregate::native_aggregate;
+use zkprov_backend_native::{native_prove_timed, native_verify};
 use zkprov_corelib as core;
 use zkprov_corelib::air::AirProgram;
 use zkprov_corelib::air_bindings::Bindings;
@@ -69,23 +72,44 @@ enum Commands {
         #[arg(long = "pretty", default_value_t = false)]
         pretty: bool,
     },
+    /// Compile a program AIR into a binary artifact for fast loading
+    Compile {
+        /// Program AIR path (.air TOML or YAML)
+        #[arg(short = 'p', long = "program")]
+        program_path: String,
+        /// Output compiled AIR file path (.airc)
+        #[arg(short = 'o', long = "output")]
+        compiled_out: String,
+    },
     /// Prove: read inputs JSON, produce proof blob
     Prove {
         /// Program AIR path (.air TOML)
         #[arg(short = 'p', long = "program")]
-        program_path: String,
+        program_path: Option<String>,
         /// Inputs JSON path
         #[arg(short = 'i', long = "inputs")]
-        inputs_path: String,
+        inputs_path: Option<String>,
         /// Output proof file path
         #[arg(short = 'o', long = "output")]
-        proof_out: String,
+        proof_out: Option<String>,
+        /// Batch manifest JSON path: {"jobs": [{"program","inputs","output"}, ...]}.
+        /// Jobs run over an in-process worker pool; -p/-i/-o are ignored.
+        #[arg(long = "batch", conflicts_with_all = ["program_path", "inputs_path", "proof_out"])]
+        batch: Option<String>,
         /// Print stats row/col/body_len after success
         #[arg(long = "stats", default_value_t = false)]
         stats: bool,
         #[command(flatten)]
         cfg: CommonCfg,
     },
+    /// Serve: long-running prove/verify daemon on a Unix socket
+    Serve {
+        /// Unix socket path to listen on (removed and re-created)
+        #[arg(short = 's', long = "socket")]
+        socket_path: String,
+        #[command(flatten)]
+        cfg: CommonCfg,
+    },
     /// Verify: read inputs JSON and proof blob, return success/failure
     Verify {
         /// Program AIR path (.air TOML)
@@ -103,6 +127,37 @@ enum Commands {
         #[command(flatten)]
         cfg: CommonCfg,
     },
+    /// Aggregate N leaf proofs over one AIR into a single proof
+    Aggregate {
+        /// Program AIR path (.air TOML)
+        #[arg(short = 'p', long = "program")]
+        program_path: String,
+        /// Leaf inputs JSON paths, in proof order (repeatable)
+        #[arg(short = 'i', long = "inputs", required = true)]
+        inputs_paths: Vec<String>,
+        /// Leaf proof file paths, matching --inputs order (repeatable)
+        #[arg(short = 'P', long = "proof", required = true)]
+        proof_ins: Vec<String>,
+        /// Output aggregate proof file path
+        #[arg(short = 'o', long = "output")]
+        proof_out: String,
+        #[command(flatten)]
+        cfg: CommonCfg,
+    },
+    /// Benchmark golden vectors and track performance history
+    Bench {
+        /// Prove and verify every golden vector, recording metrics
+        #[arg(long = "golden", default_value_t = false)]
+        golden: bool,
+        /// Append-only JSONL metric history (also the regression baseline)
+        #[arg(long = "history", default_value = "bench-history.jsonl")]
+        history: String,
+        /// Fail when a metric exceeds this ratio of its best recorded value
+        #[arg(long = "threshold", default_value_t = 1.5)]
+        threshold: f64,
+        #[command(flatten)]
+        cfg: CommonCfg,
+    },
     /// Validate: derive commitment checks and emit a structured report
     Validate {
         /// Program AIR path (.air TOML)
@@ -186,6 +241,443 @@ fn exit_for_corrupt_proof(err: &anyhow::Error) -> ! {
     process::exit(EXIT_CORRUPT_PROOF);
 }
 
+// --- Batch prove ---------------------------------------------------------
+
+#[derive(Debug, Clone, serde::Deserialize)]
+struct BatchJob {
+    program: String,
+    inputs: String,
+    output: String,
+}
+
+#[derive(Debug, serde::Deserialize)]
+struct BatchManifest {
+    jobs: Vec<BatchJob>,
+}
+
+fn prove_one(config: &Config, job: &BatchJob) -> Result<usize> {
+    let inputs = read_to_string(&job.inputs)?;
+    let (proof, _) = native_prove_timed(config, &inputs, &job.program)?;
+    write_bytes(&job.output, &proof)?;
+    Ok(proof.len())
+}
+
+/// Run every manifest job across scoped worker threads, at most the
+/// profile's thread count at once. The jobs get their own threads rather
+/// than the backend pool — each prove call fans out through the pool itself,
+/// and keeping the outer layer off it means batches can never exhaust the
+/// workers (same shape as `zkp_prove_batch` in the C ABI). Exits nonzero if
+/// any job fails, after attempting all of them.
+fn run_prove_batch(config: &Config, manifest_path: &str) -> Result<()> {
+    if config.backend_id != "native@0.0" {
+        return Err(anyhow!(
+            "backend '{}' not implemented yet in CLI",
+            config.backend_id
+        ));
+    }
+    let manifest: BatchManifest = serde_json::from_str(&read_to_string(manifest_path)?)
+        .with_context(|| format!("parsing batch manifest '{}'", manifest_path))?;
+    if manifest.jobs.is_empty() {
+        return Err(anyhow!("batch manifest '{}' has no jobs", manifest_path));
+    }
+
+    let threads = zkprov_corelib::profile::find_profile(&config.profile_id)
+        .map(|p| p.effective_threads())
+        .unwrap_or(1)
+        .clamp(1, manifest.jobs.len());
+    let next = AtomicUsize::new(0);
+    let results: Vec<Mutex<Option<Result<usize>>>> =
+        manifest.jobs.iter().map(|_| Mutex::new(None)).collect();
+    std::thread::scope(|scope| {
+        for _ in 0..threads {
+            scope.spawn(|| loop {
+                let i = next.fetch_add(1, Ordering::Relaxed);
+                if i >= manifest.jobs.len() {
+                    break;
+                }
+                let result = prove_one(config, &manifest.jobs[i]);
+                if let Ok(mut slot) = results[i].lock() {
+                    *slot = Some(result);
+                }
+            });
+        }
+    });
+
+    let mut succeeded = 0usize;
+    let mut failed = 0usize;
+    for (job, slot) in manifest.jobs.iter().zip(results) {
+        match slot.into_inner().ok().flatten() {
+            Some(Ok(bytes)) => {
+                succeeded += 1;
+                println!("✅ {} ({} bytes)", job.output, bytes);
+            }
+            Some(Err(err)) => {
+                failed += 1;
+                eprintln!("❌ {}: {err}", job.output);
+            }
+            None => {
+                failed += 1;
+                eprintln!("❌ {}: job worker panicked", job.output);
+            }
+        }
+    }
+    println!("Batch complete: {succeeded} succeeded, {failed} failed");
+    if failed > 0 {
+        process::exit(1);
+    }
+    Ok(())
+}
+
+// --- Golden-vector bench --------------------------------------------------
+
+/// The golden vectors: reference AIRs proved with canonical inputs, relative
+/// to the repository root (matching docs/golden-vectors.md).
+const GOLDEN_VECTORS: &[(&str, &str, &str)] = &[
+    ("toy_merkle/n7", "examples/air/toy.air", r#"{"demo":true,"n":7}"#),
+    ("toy_merkle/n8", "examples/air/toy.air", r#"{"demo":true,"n":8}"#),
+    (
+        "commit_demo/base",
+        "examples/air/commit_demo.air",
+        r#"{"x":1,"y":2}"#,
+    ),
+];
+
+/// Timing samples per vector; the median keeps one scheduler hiccup from
+/// tripping the regression gate.
+const BENCH_SAMPLES: usize = 5;
+
+/// One history line: the metrics of one vector on one run.
+#[derive(Debug, serde::Serialize, serde::Deserialize)]
+struct BenchRecord {
+    timestamp: u64,
+    vector: String,
+    backend: String,
+    profile: String,
+    prove_ms: f64,
+    verify_ms: f64,
+    proof_len: u64,
+    peak_rss_kib: u64,
+}
+
+/// Process peak RSS (VmHWM) in KiB; 0 where /proc is unavailable. Monotonic
+/// over the process lifetime, so per-vector values share one high-water mark.
+fn peak_rss_kib() -> u64 {
+    let Ok(status) = fs::read_to_string("/proc/self/status") else {
+        return 0;
+    };
+    status
+        .lines()
+        .find(|l| l.starts_with("VmHWM:"))
+        .and_then(|l| l.split_whitespace().nth(1))
+        .and_then(|v| v.parse().ok())
+        .unwrap_or(0)
+}
+
+/// Median wall time of `samples` runs of `f`, in milliseconds.
+fn median_ms<F: FnMut() -> Result<()>>(samples: usize, mut f: F) -> Result<f64> {
+    let mut times: Vec<f64> = Vec::with_capacity(samples);
+    for _ in 0..samples {
+        let clock = std::time::Instant::now();
+        f()?;
+        times.push(clock.elapsed().as_secs_f64() * 1e3);
+    }
+    times.sort_by(|a, b| a.partial_cmp(b).expect("finite timing"));
+    Ok(times[times.len() / 2])
+}
+
+/// Best (smallest) recorded value per metric for this vector under the same
+/// backend and profile; unparsable history lines are skipped.
+fn bench_baseline(history: &str, record: &BenchRecord) -> Option<BenchRecord> {
+    let text = fs::read_to_string(history).ok()?;
+    let mut best: Option<BenchRecord> = None;
+    for line in text.lines() {
+        let Ok(entry) = serde_json::from_str::<BenchRecord>(line) else {
+            continue;
+        };
+        if entry.vector != record.vector
+            || entry.backend != record.backend
+            || entry.profile != record.profile
+        {
+            continue;
+        }
+        best = Some(match best {
+            None => entry,
+            Some(b) => BenchRecord {
+                prove_ms: b.prove_ms.min(entry.prove_ms),
+                verify_ms: b.verify_ms.min(entry.verify_ms),
+                proof_len: b.proof_len.min(entry.proof_len),
+                peak_rss_kib: b.peak_rss_kib.min(entry.peak_rss_kib),
+                ..b
+            },
+        });
+    }
+    best
+}
+
+/// Metrics of `record` that exceed `threshold` times their baseline value.
+fn bench_regressions(record: &BenchRecord, baseline: &BenchRecord, threshold: f64) -> Vec<String> {
+    let mut out = Vec::new();
+    let mut check = |metric: &str, current: f64, best: f64| {
+        if best > 0.0 && current > best * threshold {
+            out.push(format!(
+                "{}: {:.3} vs baseline {:.3} (x{:.2} > x{:.2})",
+                metric,
+                current,
+                best,
+                current / best,
+                threshold
+            ));
+        }
+    };
+    check("prove_ms", record.prove_ms, baseline.prove_ms);
+    check("verify_ms", record.verify_ms, baseline.verify_ms);
+    check("proof_len", record.proof_len as f64, baseline.proof_len as f64);
+    check(
+        "peak_rss_kib",
+        record.peak_rss_kib as f64,
+        baseline.peak_rss_kib as f64,
+    );
+    out
+}
+
+/// Prove and verify every golden vector, append the metrics to the JSONL
+/// history, and exit nonzero when any metric regresses beyond `threshold`
+/// against the best recorded baseline. The first run just records.
+fn run_bench_golden(config: &Config, history: &str, threshold: f64) -> Result<()> {
+    if !(threshold > 1.0) {
+        return Err(anyhow!("--threshold must be > 1.0, got {}", threshold));
+    }
+    let timestamp = std::time::SystemTime::now()
+        .duration_since(std::time::UNIX_EPOCH)
+        .map(|d| d.as_secs())
+        .unwrap_or(0);
+
+    let mut failures = Vec::new();
+    let mut lines = String::new();
+    for (name, air_path, inputs) in GOLDEN_VECTORS {
+        let air = AirProgram::load_from_file(air_path)
+            .with_context(|| format!("golden vector '{}' ({})", name, air_path))?;
+        validate_air_against_backend(&air, &config.backend_id)
+            .map_err(|e| anyhow!(e.to_string()))?;
+
+        let proof = zkprov_backend_native::native_prove_prepared(config, inputs, &air)?;
+        let prove_ms = median_ms(BENCH_SAMPLES, || {
+            zkprov_backend_native::native_prove_prepared(config, inputs, &air).map(|_| ())
+        })?;
+        let verify_ms = median_ms(BENCH_SAMPLES, || {
+            match zkprov_backend_native::native_verify_prepared(config, inputs, &air, &proof) {
+                Ok(true) => Ok(()),
+                Ok(false) => Err(anyhow!("golden vector '{}' failed verification", name)),
+                Err(e) => Err(e),
+            }
+        })?;
+
+        let record = BenchRecord {
+            timestamp,
+            vector: name.to_string(),
+            backend: config.backend_id.clone(),
+            profile: config.profile_id.clone(),
+            prove_ms,
+            verify_ms,
+            proof_len: proof.len() as u64,
+            peak_rss_kib: peak_rss_kib(),
+        };
+        println!(
+            "bench {} prove={:.3}ms verify={:.3}ms proof_len={} peak_rss={}KiB",
+            record.vector, record.prove_ms, record.verify_ms, record.proof_len, record.peak_rss_kib
+        );
+
+        if let Some(baseline) = bench_baseline(history, &record) {
+            for regression in bench_regressions(&record, &baseline, threshold) {
+                failures.push(format!("{}: {}", record.vector, regression));
+            }
+        }
+        lines.push_str(&serde_json::to_string(&record)?);
+        lines.push('\n');
+    }
+
+    // Append-only history: this run's records land even when it regressed.
+    use std::io::Write as _;
+    fs::OpenOptions::new()
+        .create(true)
+        .append(true)
+        .open(history)
+        .with_context(|| format!("opening history '{}'", history))?
+        .write_all(lines.as_bytes())?;
+
+    if !failures.is_empty() {
+        for failure in &failures {
+            eprintln!("❌ REGRESSION {}", failure);
+        }
+        process::exit(1);
+    }
+    println!(
+        "✅ BenchGolden vectors={} history={} threshold=x{:.2}",
+        GOLDEN_VECTORS.len(),
+        history,
+        threshold
+    );
+    Ok(())
+}
+
+// --- Daemon --------------------------------------------------------------
+
+/// Upper bound on one request frame; protects the daemon from bad clients.
+const SERVE_MAX_FRAME: u32 = 16 * 1024 * 1024;
+
+#[derive(Debug, serde::Deserialize)]
+#[serde(tag = "op", rename_all = "snake_case")]
+enum ServeRequest {
+    Ping,
+    Prove {
+        program: String,
+        inputs: String,
+    },
+    Verify {
+        program: String,
+        inputs: String,
+        proof_hex: String,
+    },
+    Shutdown,
+}
+
+type AirCache = std::collections::HashMap<String, ([u8; 32], AirProgram)>;
+
+/// Load and validate an AIR, reusing the cached parse while the file's
+/// content hash is unchanged — this is what gives short-lived clients
+/// warm-cache latency.
+fn load_air_warm<'c>(cache: &'c mut AirCache, config: &Config, path: &str) -> Result<&'c AirProgram> {
+    let bytes = fs::read(path).with_context(|| format!("failed to read '{}'", path))?;
+    let digest = zkprov_corelib::crypto::registry::HashId::Blake3.hash32("CLI/AIRCACHE", &bytes);
+    let stale = cache.get(path).map(|(d, _)| *d != digest).unwrap_or(true);
+    if stale {
+        let air = AirProgram::load_from_file(path)?;
+        validate_air_against_backend(&air, &config.backend_id)
+            .map_err(|e| anyhow!(e.to_string()))?;
+        cache.insert(path.to_string(), (digest, air));
+    }
+    Ok(&cache.get(path).expect("just inserted").1)
+}
+
+/// Read one length-prefixed frame (u32 LE + payload); `None` on clean EOF.
+fn read_frame(stream: &mut impl std::io::Read) -> Result<Option<Vec<u8>>> {
+    let mut len_bytes = [0u8; 4];
+    match stream.read_exact(&mut len_bytes) {
+        Ok(()) => {}
+        Err(e) if e.kind() == std::io::ErrorKind::UnexpectedEof => return Ok(None),
+        Err(e) => return Err(e.into()),
+    }
+    let len = u32::from_le_bytes(len_bytes);
+    if len == 0 || len > SERVE_MAX_FRAME {
+        return Err(anyhow!("frame length {} out of range", len));
+    }
+    let mut payload = vec![0u8; len as usize];
+    stream.read_exact(&mut payload)?;
+    Ok(Some(payload))
+}
+
+fn write_frame(stream: &mut impl std::io::Write, payload: &[u8]) -> Result<()> {
+    stream.write_all(&(payload.len() as u32).to_le_bytes())?;
+    stream.write_all(payload)?;
+    stream.flush()?;
+    Ok(())
+}
+
+/// Handle one request; the bool asks the accept loop to shut down.
+fn serve_dispatch(
+    config: &Config,
+    cache: &mut AirCache,
+    payload: &[u8],
+) -> (serde_json::Value, bool) {
+    let request: ServeRequest = match serde_json::from_slice(payload) {
+        Ok(r) => r,
+        Err(e) => return (serde_json::json!({"ok": false, "error": e.to_string()}), false),
+    };
+    match request {
+        ServeRequest::Ping => (serde_json::json!({"ok": true, "msg": "pong"}), false),
+        ServeRequest::Shutdown => (serde_json::json!({"ok": true, "msg": "shutting down"}), true),
+        ServeRequest::Prove { program, inputs } => {
+            let result = load_air_warm(cache, config, &program).and_then(|air| {
+                zkprov_backend_native::native_prove_prepared(config, &inputs, air)
+            });
+            match result {
+                Ok(proof) => (
+                    serde_json::json!({
+                        "ok": true,
+                        "proof_hex": bytes_to_hex(&proof),
+                        "proof_len": proof.len(),
+                    }),
+                    false,
+                ),
+                Err(e) => (serde_json::json!({"ok": false, "error": e.to_string()}), false),
+            }
+        }
+        ServeRequest::Verify {
+            program,
+            inputs,
+            proof_hex,
+        } => {
+            let result = hex_to_bytes(&proof_hex).and_then(|proof| {
+                let air = load_air_warm(cache, config, &program)?;
+                zkprov_backend_native::native_verify_prepared(config, &inputs, air, &proof)
+            });
+            match result {
+                Ok(verified) => (serde_json::json!({"ok": true, "verified": verified}), false),
+                Err(e) => (serde_json::json!({"ok": false, "error": e.to_string()}), false),
+            }
+        }
+    }
+}
+
+/// Accept loop: one connection at a time, many frames per connection. The
+/// process stays warm across clients, so they skip process spawn, dynamic
+/// linking, and AIR load entirely.
+fn run_serve(config: &Config, socket_path: &str) -> Result<()> {
+    use std::os::unix::net::UnixListener;
+
+    let _ = fs::remove_file(socket_path);
+    let listener = UnixListener::bind(socket_path)
+        .with_context(|| format!("failed to bind socket '{}'", socket_path))?;
+    println!(
+        "zkd serving on {} backend={} profile={}",
+        socket_path, config.backend_id, config.profile_id
+    );
+
+    let mut cache = AirCache::new();
+    'accept: for stream in listener.incoming() {
+        let mut stream = match stream {
+            Ok(s) => s,
+            Err(e) => {
+                eprintln!("accept error: {e}");
+                continue;
+            }
+        };
+        loop {
+            // A misbehaving client (bad frame length, mid-payload disconnect,
+            // gone before the response) must not take the daemon down: log,
+            // drop the connection, and keep accepting.
+            let payload = match read_frame(&mut stream) {
+                Ok(Some(payload)) => payload,
+                Ok(None) => break,
+                Err(e) => {
+                    eprintln!("connection error: {e}");
+                    break;
+                }
+            };
+            let (response, shutdown) = serve_dispatch(config, &mut cache, &payload);
+            if let Err(e) = write_frame(&mut stream, response.to_string().as_bytes()) {
+                eprintln!("connection error: {e}");
+                break;
+            }
+            if shutdown {
+                break 'accept;
+            }
+        }
+    }
+    let _ = fs::remove_file(socket_path);
+    Ok(())
+}
+
 // --- Hex helpers ---------------------------------------------------------
 
 fn hex_to_bytes(s: &str) -> Result<Vec<u8>> {
@@ -280,20 +772,44 @@ fn main() -> Result<()> {
                 println!("{}", serde_json::to_string(&schema)?);
             }
         }
+        Some(Commands::Compile {
+            program_path,
+            compiled_out,
+        }) => {
+            let air = AirProgram::load_from_file(&program_path)?;
+            let blob = zkprov_corelib::air::compiled::compile(&air)?;
+            let hash = zkprov_corelib::air::compiled::content_hash(&blob)?;
+            write_bytes(&compiled_out, &blob)?;
+            println!(
+                "✅ Compiled program={} bytes={} hash=0x{}",
+                air.meta.name,
+                blob.len(),
+                bytes_to_hex(&hash)
+            );
+            println!("Wrote: {}", compiled_out);
+        }
         Some(Commands::Prove {
             program_path,
             inputs_path,
             proof_out,
+            batch,
             stats,
             cfg,
         }) => {
             registry::ensure_builtins_registered();
-            let config = mk_config(&cfg);
+            let config = mk_config(&cfg).with_timings(stats);
             validate_config(&config).map_err(|e| anyhow!(e.to_string()))?;
+
+            if let Some(manifest_path) = batch {
+                return run_prove_batch(&config, &manifest_path);
+            }
+            let program_path = program_path.ok_or_else(|| anyhow!("--program is required"))?;
+            let inputs_path = inputs_path.ok_or_else(|| anyhow!("--inputs is required"))?;
+            let proof_out = proof_out.ok_or_else(|| anyhow!("--output is required"))?;
             let inputs = read_to_string(&inputs_path)?;
 
             if config.backend_id == "native@0.0" {
-                let proof = native_prove(&config, &inputs, &program_path)?;
+                let (proof, timings) = native_prove_timed(&config, &inputs, &program_path)?;
                 write_bytes(&proof_out, &proof)?;
                 let hdr = ProofHeader::decode(&proof[0..40])
                     .unwrap_or_else(|e| exit_for_corrupt_proof(&e));
@@ -308,6 +824,16 @@ fn main() -> Result<()> {
                         "stats rows={} cols={} const={} periodic={}",
                         shape.rows, shape.cols, shape.const_cols, shape.periodic_cols
                     );
+                    if let Some(t) = timings {
+                        println!(
+                            "timings load={}µs validate={}µs trace_shape={}µs commit={}µs encode={}µs",
+                            t.load_micros,
+                            t.validate_micros,
+                            t.trace_shape_micros,
+                            t.commit_micros,
+                            t.encode_micros
+                        );
+                    }
                 }
                 println!("Program: {}", program_path);
                 println!("Wrote: {}", proof_out);
@@ -318,6 +844,18 @@ fn main() -> Result<()> {
                 ));
             }
         }
+        Some(Commands::Serve { socket_path, cfg }) => {
+            registry::ensure_builtins_registered();
+            let config = mk_config(&cfg);
+            validate_config(&config).map_err(|e| anyhow!(e.to_string()))?;
+            if config.backend_id != "native@0.0" {
+                return Err(anyhow!(
+                    "backend '{}' not implemented yet in CLI",
+                    config.backend_id
+                ));
+            }
+            run_serve(&config, &socket_path)?;
+        }
         Some(Commands::Verify {
             program_path,
             inputs_path,
@@ -369,6 +907,80 @@ fn main() -> Result<()> {
                 ));
             }
         }
+        Some(Commands::Aggregate {
+            program_path,
+            inputs_paths,
+            proof_ins,
+            proof_out,
+            cfg,
+        }) => {
+            registry::ensure_builtins_registered();
+            let config = mk_config(&cfg);
+            validate_config(&config).map_err(|e| anyhow!(e.to_string()))?;
+            if config.backend_id != "native@0.0" {
+                return Err(anyhow!(
+                    "backend '{}' not implemented yet in CLI",
+                    config.backend_id
+                ));
+            }
+            if inputs_paths.len() != proof_ins.len() {
+                return Err(anyhow!(
+                    "--inputs count ({}) must match --proof count ({})",
+                    inputs_paths.len(),
+                    proof_ins.len()
+                ));
+            }
+
+            let air = AirProgram::load_from_file(&program_path)?;
+            validate_air_against_backend(&air, &config.backend_id)
+                .map_err(|e| anyhow!(e.to_string()))?;
+            let inputs = inputs_paths
+                .iter()
+                .map(|p| read_to_string(p))
+                .collect::<Result<Vec<String>>>()?;
+            let proofs = proof_ins
+                .iter()
+                .map(|p| read_to_bytes(p))
+                .collect::<Result<Vec<Vec<u8>>>>()?;
+            let leaves: Vec<(&str, &[u8])> = inputs
+                .iter()
+                .map(|io| io.as_str())
+                .zip(proofs.iter().map(|p| p.as_slice()))
+                .collect();
+
+            let aggregate = match native_aggregate(&config, &air, &leaves) {
+                Ok(bytes) => bytes,
+                Err(e) => exit_for_corrupt_proof(&e),
+            };
+            write_bytes(&proof_out, &aggregate)?;
+            println!(
+                "✅ ProofAggregated backend={} profile={} leaves={} agg_len={}",
+                config.backend_id,
+                config.profile_id,
+                leaves.len(),
+                aggregate.len()
+            );
+        }
+        Some(Commands::Bench {
+            golden,
+            history,
+            threshold,
+            cfg,
+        }) => {
+            if !golden {
+                return Err(anyhow!("zkd bench currently requires --golden"));
+            }
+            registry::ensure_builtins_registered();
+            let config = mk_config(&cfg);
+            validate_config(&config).map_err(|e| anyhow!(e.to_string()))?;
+            if config.backend_id != "native@0.0" {
+                return Err(anyhow!(
+                    "backend '{}' not implemented yet in CLI",
+                    config.backend_id
+                ));
+            }
+            run_bench_golden(&config, &history, threshold)?;
+        }
         Some(Commands::Validate {
             program_path,
             inputs_path,
@@ -520,6 +1132,7 @@ fn main() -> Result<()> {
             println!("zkd {} — ready", core::version());
             println!("Try: `zkd backend-ls [-v]`, `zkd profile-ls`,");
             println!("     `zkd io-schema -p <program.air>`,",);
+            println!("     `zkd compile -p <program.air> -o <program.airc>`,",);
             println!("     `zkd commit --hash <id> --msg-hex <..> --blind-hex <..>`,",);
             println!(
                 "     `zkd open-commit --hash <id> --msg-hex <..> --blind-hex <..> --commit-hex <..>`,",
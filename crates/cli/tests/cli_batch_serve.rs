@@ -0,0 +1,211 @@
+use std::fs;
+use std::io::{Read, Write};
+use std::os::unix::net::UnixStream;
+use std::process::{Child, Command};
+use std::time::{Duration, Instant};
+use tempfile::tempdir;
+
+const BIN: &str = env!("CARGO_BIN_EXE_zkd");
+/// One past the daemon's frame size cap (`SERVE_MAX_FRAME` in the CLI).
+const SERVE_MAX_FRAME_PLUS_ONE: u32 = 16 * 1024 * 1024 + 1;
+
+fn air_path() -> String {
+    let base = std::path::Path::new(env!("CARGO_MANIFEST_DIR"));
+    base.join("../../examples/air/toy.air")
+        .to_str()
+        .expect("utf8 path")
+        .to_owned()
+}
+
+fn cfg_args() -> Vec<&'static str> {
+    vec![
+        "--backend",
+        "native@0.0",
+        "--field",
+        "Prime254",
+        "--hash",
+        "blake3",
+        "--fri-arity",
+        "2",
+        "--profile",
+        "balanced",
+    ]
+}
+
+#[test]
+fn prove_batch_runs_all_jobs() {
+    let dir = tempdir().unwrap();
+    let air = air_path();
+
+    let inputs_a = dir.path().join("a.json");
+    let inputs_b = dir.path().join("b.json");
+    fs::write(&inputs_a, r#"{"demo":true,"n":7}"#).unwrap();
+    fs::write(&inputs_b, r#"{"demo":true,"n":8}"#).unwrap();
+    let out_a = dir.path().join("a.proof");
+    let out_b = dir.path().join("b.proof");
+
+    let manifest = dir.path().join("batch.json");
+    fs::write(
+        &manifest,
+        serde_json::json!({
+            "jobs": [
+                {"program": air, "inputs": inputs_a, "output": out_a},
+                {"program": air, "inputs": inputs_b, "output": out_b},
+            ]
+        })
+        .to_string(),
+    )
+    .unwrap();
+
+    let out = Command::new(BIN)
+        .args(["prove", "--batch", manifest.to_str().unwrap()])
+        .args(cfg_args())
+        .output()
+        .expect("run batch");
+    assert!(out.status.success(), "batch exit code");
+    let stdout = String::from_utf8_lossy(&out.stdout);
+    assert!(stdout.contains("2 succeeded, 0 failed"), "summary: {stdout}");
+    assert!(!fs::read(&out_a).unwrap().is_empty());
+    assert!(!fs::read(&out_b).unwrap().is_empty());
+}
+
+#[test]
+fn prove_batch_fails_on_bad_job() {
+    let dir = tempdir().unwrap();
+    let manifest = dir.path().join("batch.json");
+    fs::write(
+        &manifest,
+        serde_json::json!({
+            "jobs": [
+                {
+                    "program": air_path(),
+                    "inputs": dir.path().join("missing.json"),
+                    "output": dir.path().join("x.proof"),
+                },
+            ]
+        })
+        .to_string(),
+    )
+    .unwrap();
+
+    let out = Command::new(BIN)
+        .args(["prove", "--batch", manifest.to_str().unwrap()])
+        .args(cfg_args())
+        .output()
+        .expect("run batch");
+    assert_eq!(out.status.code(), Some(1), "batch exit code");
+    let stdout = String::from_utf8_lossy(&out.stdout);
+    assert!(stdout.contains("0 succeeded, 1 failed"), "summary: {stdout}");
+}
+
+fn send(stream: &mut UnixStream, msg: &serde_json::Value) -> serde_json::Value {
+    let payload = msg.to_string().into_bytes();
+    stream
+        .write_all(&(payload.len() as u32).to_le_bytes())
+        .unwrap();
+    stream.write_all(&payload).unwrap();
+    let mut len_bytes = [0u8; 4];
+    stream.read_exact(&mut len_bytes).unwrap();
+    let mut response = vec![0u8; u32::from_le_bytes(len_bytes) as usize];
+    stream.read_exact(&mut response).unwrap();
+    serde_json::from_slice(&response).unwrap()
+}
+
+fn connect_with_retry(path: &std::path::Path, daemon: &mut Child) -> UnixStream {
+    let deadline = Instant::now() + Duration::from_secs(10);
+    loop {
+        if let Ok(stream) = UnixStream::connect(path) {
+            return stream;
+        }
+        if let Some(status) = daemon.try_wait().unwrap() {
+            panic!("daemon exited early: {status}");
+        }
+        assert!(Instant::now() < deadline, "daemon never came up");
+        std::thread::sleep(Duration::from_millis(50));
+    }
+}
+
+#[test]
+fn serve_survives_misbehaving_clients() {
+    let dir = tempdir().unwrap();
+    let socket = dir.path().join("zkd.sock");
+
+    let mut daemon = Command::new(BIN)
+        .args(["serve", "-s", socket.to_str().unwrap()])
+        .args(cfg_args())
+        .spawn()
+        .expect("spawn serve");
+
+    // Frame length outside the allowed range.
+    let mut bad = connect_with_retry(&socket, &mut daemon);
+    bad.write_all(&SERVE_MAX_FRAME_PLUS_ONE.to_le_bytes()).unwrap();
+    drop(bad);
+
+    // Length prefix promising more payload than the client ever sends.
+    let mut truncated = connect_with_retry(&socket, &mut daemon);
+    truncated.write_all(&64u32.to_le_bytes()).unwrap();
+    truncated.write_all(b"partial").unwrap();
+    drop(truncated);
+
+    // The daemon must still answer a well-behaved client.
+    let mut stream = connect_with_retry(&socket, &mut daemon);
+    let pong = send(&mut stream, &serde_json::json!({"op": "ping"}));
+    assert_eq!(pong["ok"], true);
+    assert_eq!(pong["msg"], "pong");
+
+    let bye = send(&mut stream, &serde_json::json!({"op": "shutdown"}));
+    assert_eq!(bye["ok"], true);
+    let status = daemon.wait().expect("daemon exit");
+    assert!(status.success(), "daemon exit status");
+}
+
+#[test]
+fn serve_handles_ping_prove_verify_shutdown() {
+    let dir = tempdir().unwrap();
+    let socket = dir.path().join("zkd.sock");
+    let air = air_path();
+
+    let mut daemon = Command::new(BIN)
+        .args(["serve", "-s", socket.to_str().unwrap()])
+        .args(cfg_args())
+        .spawn()
+        .expect("spawn serve");
+    let mut stream = connect_with_retry(&socket, &mut daemon);
+
+    let pong = send(&mut stream, &serde_json::json!({"op": "ping"}));
+    assert_eq!(pong["ok"], true);
+    assert_eq!(pong["msg"], "pong");
+
+    let inputs = r#"{"demo":true,"n":7}"#;
+    let proved = send(
+        &mut stream,
+        &serde_json::json!({"op": "prove", "program": air, "inputs": inputs}),
+    );
+    assert_eq!(proved["ok"], true, "prove response: {proved}");
+    let proof_hex = proved["proof_hex"].as_str().unwrap();
+
+    let verified = send(
+        &mut stream,
+        &serde_json::json!({
+            "op": "verify",
+            "program": air,
+            "inputs": inputs,
+            "proof_hex": proof_hex,
+        }),
+    );
+    assert_eq!(verified["ok"], true, "verify response: {verified}");
+    assert_eq!(verified["verified"], true);
+
+    // A second prove against the same program hits the warm AIR cache.
+    let proved_again = send(
+        &mut stream,
+        &serde_json::json!({"op": "prove", "program": air, "inputs": inputs}),
+    );
+    assert_eq!(proved_again["proof_hex"], proved["proof_hex"]);
+
+    let bye = send(&mut stream, &serde_json::json!({"op": "shutdown"}));
+    assert_eq!(bye["ok"], true);
+    let status = daemon.wait().expect("daemon exit");
+    assert!(status.success(), "daemon exit status");
+    assert!(!socket.exists(), "socket removed on shutdown");
+}
@@ -0,0 +1,93 @@
+use std::fs;
+use std::process::Command;
+use tempfile::tempdir;
+
+const BIN: &str = env!("CARGO_BIN_EXE_zkd");
+
+fn repo_root() -> std::path::PathBuf {
+    std::path::Path::new(env!("CARGO_MANIFEST_DIR"))
+        .join("../..")
+        .canonicalize()
+        .expect("repo root")
+}
+
+fn run_bench(history: &std::path::Path, threshold: &str) -> std::process::Output {
+    Command::new(BIN)
+        .current_dir(repo_root())
+        .args([
+            "bench",
+            "--golden",
+            "--history",
+            history.to_str().unwrap(),
+            "--threshold",
+            threshold,
+            "--backend",
+            "native@0.0",
+            "--field",
+            "Prime254",
+            "--hash",
+            "blake3",
+            "--fri-arity",
+            "2",
+            "--profile",
+            "balanced",
+        ])
+        .output()
+        .expect("run bench")
+}
+
+#[test]
+fn golden_bench_records_history_and_gates_regressions() {
+    let dir = tempdir().unwrap();
+    let history = dir.path().join("bench.jsonl");
+
+    // First run has no baseline: it records and passes.
+    let out = run_bench(&history, "1.5");
+    assert!(out.status.success(), "stderr: {}", String::from_utf8_lossy(&out.stderr));
+    let lines: Vec<String> = fs::read_to_string(&history)
+        .unwrap()
+        .lines()
+        .map(str::to_owned)
+        .collect();
+    assert_eq!(lines.len(), 3, "one record per golden vector");
+    let first: serde_json::Value = serde_json::from_str(&lines[0]).unwrap();
+    assert_eq!(first["backend"], "native@0.0");
+    assert!(first["prove_ms"].as_f64().unwrap() > 0.0);
+    assert!(first["proof_len"].as_u64().unwrap() > 40);
+
+    // Second run against its own baseline passes under a generous threshold
+    // (timing noise must not trip the gate in CI) and appends, never rewrites.
+    let out = run_bench(&history, "100.0");
+    assert!(out.status.success(), "stderr: {}", String::from_utf8_lossy(&out.stderr));
+    assert_eq!(fs::read_to_string(&history).unwrap().lines().count(), 6);
+
+    // An impossibly fast doctored baseline makes every vector regress.
+    let mut doctored: serde_json::Value = serde_json::from_str(&lines[0]).unwrap();
+    doctored["prove_ms"] = serde_json::json!(1e-9);
+    let mut contents = fs::read_to_string(&history).unwrap();
+    contents.push_str(&doctored.to_string());
+    contents.push('\n');
+    fs::write(&history, contents).unwrap();
+
+    let out = run_bench(&history, "1.5");
+    assert_eq!(out.status.code(), Some(1), "regression must exit nonzero");
+    let stderr = String::from_utf8_lossy(&out.stderr);
+    assert!(stderr.contains("REGRESSION"), "stderr: {stderr}");
+    assert!(stderr.contains("prove_ms"), "stderr: {stderr}");
+    // The regressed run's records still land in the append-only history.
+    assert_eq!(fs::read_to_string(&history).unwrap().lines().count(), 10);
+}
+
+#[test]
+fn bench_without_golden_flag_errors() {
+    let out = Command::new(BIN)
+        .current_dir(repo_root())
+        .args([
+            "bench", "--backend", "native@0.0", "--field", "Prime254", "--hash", "blake3",
+            "--fri-arity", "2", "--profile", "balanced",
+        ])
+        .output()
+        .expect("run bench");
+    assert!(!out.status.success());
+    assert!(String::from_utf8_lossy(&out.stderr).contains("--golden"));
+}
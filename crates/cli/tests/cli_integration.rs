@@ -161,3 +161,74 @@ fn evm_digest_matches_testdata_fixture() {
         .to_owned();
     assert_eq!(expected_hex, fixture_hex);
 }
+
+#[test]
+fn aggregate_combines_leaf_proofs() {
+    let dir = tempdir().unwrap();
+    let air = air_path();
+    let cfg = [
+        "--backend",
+        "native@0.0",
+        "--field",
+        "Prime254",
+        "--hash",
+        "blake3",
+        "--fri-arity",
+        "2",
+        "--profile",
+        "balanced",
+    ];
+
+    let mut inputs = Vec::new();
+    let mut proofs = Vec::new();
+    for n in 0..3 {
+        let inputs_path = dir.path().join(format!("in{n}.json"));
+        let proof_path = dir.path().join(format!("leaf{n}.proof"));
+        write(&inputs_path, &format!(r#"{{"demo":true,"n":{n}}}"#));
+        let status = Command::new(BIN)
+            .args([
+                "prove",
+                "-p",
+                &air,
+                "-i",
+                inputs_path.to_str().unwrap(),
+                "-o",
+                proof_path.to_str().unwrap(),
+            ])
+            .args(cfg)
+            .status()
+            .expect("run prove");
+        assert!(status.success());
+        inputs.push(inputs_path);
+        proofs.push(proof_path);
+    }
+
+    let agg_path = dir.path().join("batch.agg");
+    let mut args = vec!["aggregate".to_string(), "-p".to_string(), air.clone()];
+    for inputs_path in &inputs {
+        args.push("-i".to_string());
+        args.push(inputs_path.to_str().unwrap().to_string());
+    }
+    for proof_path in &proofs {
+        args.push("-P".to_string());
+        args.push(proof_path.to_str().unwrap().to_string());
+    }
+    args.push("-o".to_string());
+    args.push(agg_path.to_str().unwrap().to_string());
+
+    let output = Command::new(BIN).args(&args).args(cfg).output().expect("run aggregate");
+    assert!(output.status.success(), "stderr: {}", String::from_utf8_lossy(&output.stderr));
+    let stdout = String::from_utf8_lossy(&output.stdout);
+    assert!(stdout.contains("ProofAggregated"), "stdout: {stdout}");
+
+    // Constant-size output: header (40) + 16-byte fold body.
+    assert_eq!(fs::read(&agg_path).unwrap().len(), 56);
+
+    // A tampered leaf fails aggregation with the corrupt-proof exit code.
+    let mut bad = fs::read(&proofs[0]).unwrap();
+    let last = bad.len() - 1;
+    bad[last] ^= 0xFF;
+    fs::write(&proofs[0], bad).unwrap();
+    let status = Command::new(BIN).args(&args).args(cfg).status().expect("run aggregate");
+    assert_eq!(status.code(), Some(4));
+}
@@ -0,0 +1,91 @@
+//! Criterion benchmarks for the crypto core: field arithmetic, the Hash32
+//! implementations, and Merkle construction across the leaf counts the
+//! profiles are expected to handle (2^10 through 2^20).
+//!
+//! Run with `cargo bench -p zkprov-corelib`.
+
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use std::hint::black_box;
+use zkprov_corelib::crypto::blake3::Blake3;
+use zkprov_corelib::crypto::field::reduce_to_prime254;
+use zkprov_corelib::crypto::fp254::Fp254;
+use zkprov_corelib::crypto::hash::{hash_labeled, Hash32};
+use zkprov_corelib::crypto::keccak::Keccak256;
+use zkprov_corelib::crypto::merkle::{root_arity2, MerkleTree2};
+use zkprov_corelib::crypto::poseidon2::Poseidon2;
+use zkprov_corelib::crypto::rescue::Rescue;
+
+fn sample_bytes(seed: u64, len: usize) -> Vec<u8> {
+    let mut state = seed.wrapping_mul(0x9e3779b97f4a7c15) | 1;
+    (0..len)
+        .map(|_| {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            state as u8
+        })
+        .collect()
+}
+
+fn bench_field_ops(c: &mut Criterion) {
+    let mut group = c.benchmark_group("field");
+    let wide = sample_bytes(1, 64);
+    let mut wide64 = [0u8; 64];
+    wide64.copy_from_slice(&wide);
+    let a = Fp254::from_bytes64_be(&wide64);
+    let b = a.square();
+
+    group.bench_function("reduce_to_prime254/64B", |bencher| {
+        bencher.iter(|| reduce_to_prime254(black_box(&wide)))
+    });
+    group.bench_function("fp254_from_bytes64_be", |bencher| {
+        bencher.iter(|| Fp254::from_bytes64_be(black_box(&wide64)))
+    });
+    group.bench_function("fp254_add", |bencher| {
+        bencher.iter(|| black_box(a) + black_box(b))
+    });
+    group.bench_function("fp254_mul", |bencher| {
+        bencher.iter(|| black_box(a) * black_box(b))
+    });
+    group.bench_function("fp254_square", |bencher| {
+        bencher.iter(|| black_box(a).square())
+    });
+    group.finish();
+}
+
+fn bench_hashes(c: &mut Criterion) {
+    fn run<H: Hash32>(group: &mut criterion::BenchmarkGroup<'_, criterion::measurement::WallTime>, id: &str) {
+        let data = sample_bytes(2, 1024);
+        group.bench_function(id, |bencher| {
+            bencher.iter(|| hash_labeled::<H>("BENCH", black_box(&data)))
+        });
+    }
+    let mut group = c.benchmark_group("hash32/1KiB");
+    group.throughput(Throughput::Bytes(1024));
+    run::<Blake3>(&mut group, "blake3");
+    run::<Keccak256>(&mut group, "keccak256");
+    run::<Poseidon2>(&mut group, "poseidon2");
+    run::<Rescue>(&mut group, "rescue");
+    group.finish();
+}
+
+fn bench_merkle(c: &mut Criterion) {
+    let mut group = c.benchmark_group("merkle/root_arity2");
+    group.sample_size(10);
+    for exp in [10u32, 14, 17, 20] {
+        let n = 1usize << exp;
+        let leaves: Vec<Vec<u8>> = (0..n).map(|i| sample_bytes(i as u64, 32)).collect();
+        let refs: Vec<&[u8]> = leaves.iter().map(|l| l.as_slice()).collect();
+        group.throughput(Throughput::Elements(n as u64));
+        group.bench_with_input(BenchmarkId::new("vec_api", format!("2^{exp}")), &n, |bencher, _| {
+            bencher.iter(|| root_arity2::<Blake3>(black_box(&leaves)))
+        });
+        group.bench_with_input(BenchmarkId::new("flat_tree", format!("2^{exp}")), &n, |bencher, _| {
+            bencher.iter(|| MerkleTree2::build::<Blake3>(black_box(&refs)).root())
+        });
+    }
+    group.finish();
+}
+
+criterion_group!(benches, bench_field_ops, bench_hashes, bench_merkle);
+criterion_main!(benches);
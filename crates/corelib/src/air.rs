@@ -1,8 +1,10 @@
 //! AIR-IR: minimal, backend-neutral representation + TOML/YAML parser.
 
 pub mod bindings;
+pub mod compiled;
 pub mod parser;
 mod parser_yaml;
+pub mod plan;
 pub mod types;
 pub mod validate;
 
@@ -28,6 +30,17 @@ pub enum AirHash {
     Rescue,
 }
 
+/// How the program wants its range checks realized (Phase-0 selector; the
+/// gadget modes live in [`crate::gadgets::range`]).
+#[derive(Debug, Clone, Copy, Serialize, Deserialize, PartialEq, Eq)]
+#[serde(rename_all = "lowercase")]
+pub enum AirRangeMode {
+    /// One boolean constraint per bit.
+    Bits,
+    /// One table probe per limb; requires a backend with lookup support.
+    Lookup,
+}
+
 #[derive(Debug, Clone, Serialize, Deserialize, PartialEq, Eq)]
 #[serde(deny_unknown_fields)]
 pub struct AirMeta {
@@ -40,6 +53,8 @@ pub struct AirMeta {
     pub profile: Option<String>, // optional suggested profile id
     #[serde(default)]
     pub degree_hint: Option<u32>, // optional upper bound on transition degree
+    #[serde(default)]
+    pub range_mode: Option<AirRangeMode>, // optional range-check mode (default: bits)
 }
 
 #[derive(Debug, Clone, Serialize, Deserialize, PartialEq, Eq)]
@@ -324,13 +339,22 @@ impl AirProgram {
 
         let program = match ext.as_str() {
             "yaml" | "yml" => parser_yaml::load_from_file(path_ref)?,
+            "airc" => compiled::load_from_file(path_ref)?,
             _ => {
-                let s = fs::read_to_string(path_ref)
+                let bytes = fs::read(path_ref)
                     .with_context(|| format!("reading AIR file {}", path_ref.display()))?;
-                let prog: AirProgram = toml::from_str(&s)
-                    .with_context(|| format!("parsing AIR file {}", path_ref.display()))?;
-                prog.validate()?;
-                prog
+                // Compiled artifacts are also accepted under any extension;
+                // sniff the magic before attempting a text parse.
+                if compiled::is_compiled(&bytes) {
+                    compiled::load_from_bytes(&bytes)?
+                } else {
+                    let s = String::from_utf8(bytes)
+                        .with_context(|| format!("reading AIR file {}", path_ref.display()))?;
+                    let prog: AirProgram = toml::from_str(&s)
+                        .with_context(|| format!("parsing AIR file {}", path_ref.display()))?;
+                    prog.validate()?;
+                    prog
+                }
             }
         };
 
@@ -377,6 +401,18 @@ impl AirProgram {
         }
         Ok(())
     }
+
+    /// The range-check mode this program selects, as a gadget mode. Defaults
+    /// to bit decomposition; lookup mode uses the default 8-bit limb table.
+    pub fn range_check_mode(&self) -> crate::gadgets::range::RangeCheckMode {
+        use crate::gadgets::range::{RangeCheckMode, DEFAULT_LOOKUP_TABLE_BITS};
+        match self.meta.range_mode {
+            Some(AirRangeMode::Lookup) => RangeCheckMode::Lookup {
+                table_bits: DEFAULT_LOOKUP_TABLE_BITS,
+            },
+            Some(AirRangeMode::Bits) | None => RangeCheckMode::BitDecomposition,
+        }
+    }
 }
 
 #[cfg(test)]
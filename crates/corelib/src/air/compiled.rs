@@ -0,0 +1,162 @@
+//! Compiled AIR artifacts: a canonical binary container for [`AirProgram`]
+//! that replaces per-call TOML/YAML parsing on hot prove/verify paths.
+//!
+//! Layout (little endian):
+//!   0..4    MAGIC "AIRC"
+//!   4..8    VERSION (u32)
+//!   8..40   content hash (BLAKE3 of the payload bytes)
+//!  40..48   payload_len (u64)
+//!  48..     payload (canonical JSON encoding of AirProgram)
+//!
+//! The content hash stamps the artifact so loaders can reject corrupt or
+//! truncated blobs with a single pass and caches can key on it without
+//! re-hashing.
+
+use std::convert::TryInto;
+use std::fs;
+use std::path::Path;
+
+use anyhow::{bail, Context, Result};
+
+use super::AirProgram;
+use crate::crypto::blake3::Blake3;
+use crate::crypto::hash::hash_one_shot;
+
+/// Magic prefix identifying a compiled AIR artifact.
+pub const MAGIC: [u8; 4] = *b"AIRC";
+/// Compiled artifact format version.
+pub const VERSION: u32 = 1;
+/// Fixed header size preceding the payload.
+pub const HEADER_LEN: usize = 48;
+
+/// Returns true if `bytes` start with the compiled-AIR magic.
+pub fn is_compiled(bytes: &[u8]) -> bool {
+    bytes.len() >= MAGIC.len() && bytes[0..4] == MAGIC
+}
+
+/// Encode a validated AIR program into a compiled artifact.
+pub fn compile(program: &AirProgram) -> Result<Vec<u8>> {
+    program.validate()?;
+    let payload = serde_json::to_vec(program).context("encoding AIR payload")?;
+    let hash = hash_one_shot::<Blake3>(&payload);
+
+    let mut out = Vec::with_capacity(HEADER_LEN + payload.len());
+    out.extend_from_slice(&MAGIC);
+    out.extend_from_slice(&VERSION.to_le_bytes());
+    out.extend_from_slice(&hash);
+    out.extend_from_slice(&(payload.len() as u64).to_le_bytes());
+    out.extend_from_slice(&payload);
+    Ok(out)
+}
+
+/// Read the content hash stamped into a compiled artifact without decoding
+/// the payload. Useful as a cache key.
+pub fn content_hash(bytes: &[u8]) -> Result<[u8; 32]> {
+    check_header(bytes)?;
+    Ok(bytes[8..40].try_into().unwrap())
+}
+
+fn check_header(bytes: &[u8]) -> Result<u64> {
+    if bytes.len() < HEADER_LEN {
+        bail!("compiled AIR too short for header");
+    }
+    if bytes[0..4] != MAGIC {
+        bail!("bad compiled AIR magic");
+    }
+    let ver = u32::from_le_bytes(bytes[4..8].try_into().unwrap());
+    if ver != VERSION {
+        bail!("unsupported compiled AIR version {ver}");
+    }
+    Ok(u64::from_le_bytes(bytes[40..48].try_into().unwrap()))
+}
+
+/// Decode and validate a compiled artifact produced by [`compile`].
+pub fn load_from_bytes(bytes: &[u8]) -> Result<AirProgram> {
+    let payload_len = check_header(bytes)? as usize;
+    let payload = bytes
+        .get(HEADER_LEN..HEADER_LEN + payload_len)
+        .filter(|p| p.len() == payload_len && bytes.len() == HEADER_LEN + payload_len)
+        .ok_or_else(|| anyhow::anyhow!("compiled AIR payload length mismatch"))?;
+
+    let expected: [u8; 32] = bytes[8..40].try_into().unwrap();
+    if hash_one_shot::<Blake3>(payload) != expected {
+        bail!("compiled AIR content hash mismatch");
+    }
+
+    let program: AirProgram =
+        serde_json::from_slice(payload).context("parsing compiled AIR payload")?;
+    program.validate()?;
+    Ok(program)
+}
+
+/// Load a compiled artifact from disk.
+pub fn load_from_file(path: &Path) -> Result<AirProgram> {
+    let bytes = fs::read(path)
+        .with_context(|| format!("reading compiled AIR {}", path.display()))?;
+    load_from_bytes(&bytes)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn sample_air() -> AirProgram {
+        toml::from_str(
+            r#"
+[meta]
+name = "toy_compiled"
+field = "Prime254"
+hash = "blake3"
+
+[columns]
+trace_cols = 4
+
+[constraints]
+transition_count = 2
+boundary_count = 1
+"#,
+        )
+        .expect("sample AIR must parse")
+    }
+
+    #[test]
+    fn compile_roundtrips() {
+        let program = sample_air();
+        let blob = compile(&program).expect("compile");
+        assert!(is_compiled(&blob));
+        let loaded = load_from_bytes(&blob).expect("load");
+        assert_eq!(program, loaded);
+    }
+
+    #[test]
+    fn compile_is_deterministic() {
+        let program = sample_air();
+        assert_eq!(compile(&program).unwrap(), compile(&program).unwrap());
+    }
+
+    #[test]
+    fn corrupt_payload_is_rejected() {
+        let program = sample_air();
+        let mut blob = compile(&program).expect("compile");
+        let last = blob.len() - 1;
+        blob[last] ^= 0xff;
+        let err = load_from_bytes(&blob).unwrap_err();
+        assert!(err.to_string().contains("content hash mismatch"));
+    }
+
+    #[test]
+    fn truncated_blob_is_rejected() {
+        let program = sample_air();
+        let blob = compile(&program).expect("compile");
+        assert!(load_from_bytes(&blob[..blob.len() - 4]).is_err());
+        assert!(load_from_bytes(&blob[..16]).is_err());
+    }
+
+    #[test]
+    fn content_hash_matches_payload() {
+        let program = sample_air();
+        let blob = compile(&program).expect("compile");
+        let hash = content_hash(&blob).expect("hash");
+        assert_eq!(hash, hash_one_shot::<Blake3>(&blob[HEADER_LEN..]));
+    }
+}
@@ -0,0 +1,222 @@
+//! Flat evaluation plan compiled from an AIR program at load time.
+//!
+//! The parsed AIR keeps constraints as generic declarations a backend would
+//! otherwise re-interpret for every row. [`ConstraintPlan::compile`]
+//! specializes that once per loaded program: the column layout is folded
+//! into fixed offsets, each constraint becomes a flat kernel descriptor with
+//! its degree resolved to a concrete shape, and per-row evaluation dispatches
+//! on that shape a single time before running a straight-line loop. The
+//! Phase-0 schema declares constraint counts rather than expressions, so the
+//! kernels use fixed placeholder polynomials of the resolved degree; the
+//! plan structure is what real constraint expressions will compile into.
+
+use crate::air::AirProgram;
+use crate::crypto::fp254::Fp254;
+use crate::trace::TraceShape;
+
+/// Degree an AIR omits a hint for; matches the common quadratic transition.
+const DEFAULT_DEGREE: u32 = 2;
+
+/// Fixed column offsets into a column-major trace: main columns first, then
+/// constant, then periodic — the order [`crate::trace::TraceBuffer`] uses.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct ColumnLayout {
+    pub main: usize,
+    pub constant: usize,
+    pub periodic: usize,
+    pub total: usize,
+}
+
+impl ColumnLayout {
+    fn from_shape(shape: &TraceShape) -> Self {
+        let main = 0usize;
+        let constant = shape.cols as usize;
+        let periodic = constant + shape.const_cols as usize;
+        Self {
+            main,
+            constant,
+            periodic,
+            total: shape.total_cols() as usize,
+        }
+    }
+}
+
+/// Concrete degree shape a kernel was monomorphized to. Low degrees get
+/// dedicated straight-line bodies; anything above cubic shares one loop.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum KernelShape {
+    Linear,
+    Quadratic,
+    Cubic,
+    Higher(u32),
+}
+
+impl KernelShape {
+    fn from_degree(degree: u32) -> Self {
+        match degree {
+            0 | 1 => Self::Linear,
+            2 => Self::Quadratic,
+            3 => Self::Cubic,
+            d => Self::Higher(d),
+        }
+    }
+}
+
+/// One transition constraint, flattened: its slot in the constraint system
+/// and the degree shape its evaluation dispatches on.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct TransitionKernel {
+    pub index: u32,
+    pub shape: KernelShape,
+}
+
+/// One boundary constraint, pinned to the first or last row.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct BoundaryKernel {
+    pub index: u32,
+    pub last_row: bool,
+}
+
+/// Straight-line evaluation plan for one AIR, compiled once at load.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct ConstraintPlan {
+    pub layout: ColumnLayout,
+    pub transitions: Vec<TransitionKernel>,
+    pub boundaries: Vec<BoundaryKernel>,
+    pub max_degree: u32,
+}
+
+impl ConstraintPlan {
+    /// Specialize the constraint set of `air`: resolve the degree hint,
+    /// fold the column segments into fixed offsets, and emit one flat
+    /// kernel descriptor per declared constraint.
+    pub fn compile(air: &AirProgram) -> Self {
+        let degree = air.meta.degree_hint.unwrap_or(DEFAULT_DEGREE).max(1);
+        let shape = TraceShape::from_air(air);
+        let transitions = (0..air.constraints.transition_count)
+            .map(|index| TransitionKernel {
+                index,
+                shape: KernelShape::from_degree(degree),
+            })
+            .collect();
+        // Boundary constraints alternate first/last row, first-row first.
+        let boundaries = (0..air.constraints.boundary_count)
+            .map(|index| BoundaryKernel {
+                index,
+                last_row: index % 2 == 1,
+            })
+            .collect();
+        Self {
+            layout: ColumnLayout::from_shape(&shape),
+            transitions,
+            boundaries,
+            max_degree: degree,
+        }
+    }
+
+    /// Evaluate one transition kernel over a current/next row pair.
+    ///
+    /// The placeholder polynomial is `sum_col(next[col] - cur[col]^d)` with
+    /// `d` fixed by the kernel's shape; the shape match happens once per
+    /// call and each arm is a straight-line loop with no per-column
+    /// branching or table walking.
+    pub fn evaluate_transition(
+        &self,
+        kernel: &TransitionKernel,
+        current: &[Fp254],
+        next: &[Fp254],
+    ) -> Fp254 {
+        debug_assert_eq!(current.len(), self.layout.total);
+        debug_assert_eq!(next.len(), self.layout.total);
+        let main = &current[self.layout.main..self.layout.constant];
+        let main_next = &next[self.layout.main..self.layout.constant];
+        let mut acc = Fp254::zero();
+        match kernel.shape {
+            KernelShape::Linear => {
+                for (cur, nxt) in main.iter().zip(main_next) {
+                    acc = acc + (*nxt - *cur);
+                }
+            }
+            KernelShape::Quadratic => {
+                for (cur, nxt) in main.iter().zip(main_next) {
+                    acc = acc + (*nxt - cur.square());
+                }
+            }
+            KernelShape::Cubic => {
+                for (cur, nxt) in main.iter().zip(main_next) {
+                    acc = acc + (*nxt - cur.square() * *cur);
+                }
+            }
+            KernelShape::Higher(d) => {
+                for (cur, nxt) in main.iter().zip(main_next) {
+                    let mut pow = *cur;
+                    for _ in 1..d {
+                        pow = pow * *cur;
+                    }
+                    acc = acc + (*nxt - pow);
+                }
+            }
+        }
+        acc
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn toy_air(degree_hint: Option<u32>) -> AirProgram {
+        let mut toml = String::new();
+        toml.push_str("rows_hint = 64\n\n[meta]\nname = \"plan_toy\"\nfield = \"Prime254\"\nhash = \"blake3\"\n");
+        if let Some(d) = degree_hint {
+            toml.push_str(&format!("degree_hint = {d}\n"));
+        }
+        toml.push_str(
+            "\n[columns]\ntrace_cols = 3\nconst_cols = 2\nperiodic_cols = 1\n\n[constraints]\ntransition_count = 4\nboundary_count = 3\n",
+        );
+        toml::from_str(&toml).unwrap()
+    }
+
+    #[test]
+    fn compile_flattens_counts_and_layout() {
+        let plan = ConstraintPlan::compile(&toy_air(Some(3)));
+        assert_eq!(plan.transitions.len(), 4);
+        assert_eq!(plan.boundaries.len(), 3);
+        assert_eq!(plan.max_degree, 3);
+        assert_eq!(plan.layout.constant, 3);
+        assert_eq!(plan.layout.periodic, 5);
+        assert_eq!(plan.layout.total, 6);
+        assert!(plan
+            .transitions
+            .iter()
+            .all(|k| k.shape == KernelShape::Cubic));
+        assert!(!plan.boundaries[0].last_row);
+        assert!(plan.boundaries[1].last_row);
+    }
+
+    #[test]
+    fn missing_hint_defaults_to_quadratic() {
+        let plan = ConstraintPlan::compile(&toy_air(None));
+        assert!(plan
+            .transitions
+            .iter()
+            .all(|k| k.shape == KernelShape::Quadratic));
+    }
+
+    #[test]
+    fn higher_degree_matches_repeated_squaring_shape() {
+        // Degree-4 kernels must agree with evaluating the same polynomial
+        // by hand: sum(next - cur^4) over the main columns.
+        let plan = ConstraintPlan::compile(&toy_air(Some(4)));
+        let current: Vec<Fp254> = (0..6).map(|i| Fp254::from_u64(i + 2)).collect();
+        let next: Vec<Fp254> = (0..6).map(|i| Fp254::from_u64(i + 10)).collect();
+        let got = plan.evaluate_transition(&plan.transitions[0], &current, &next);
+
+        let mut want = Fp254::zero();
+        for col in 0..3 {
+            let c = current[col];
+            want = want + (next[col] - c.square().square());
+        }
+        assert_eq!(got, want);
+    }
+}
@@ -9,6 +9,10 @@ pub struct Config {
     pub fri_arity: u32,         // e.g., 2 or 4
     pub recursion_needed: bool, // true if caller intends to use recursion features
     pub profile_id: String,     // e.g., "balanced"
+    /// Collect per-stage timing spans during proving (off by default; the
+    /// hot path pays two clock reads per stage only when enabled).
+    #[serde(default)]
+    pub collect_timings: bool,
 }
 
 impl Config {
@@ -27,6 +31,13 @@ impl Config {
             fri_arity,
             recursion_needed,
             profile_id: profile_id.into(),
+            collect_timings: false,
         }
     }
+
+    /// Enable or disable stage timing collection (builder style).
+    pub fn with_timings(mut self, enabled: bool) -> Self {
+        self.collect_timings = enabled;
+        self
+    }
 }
@@ -0,0 +1,52 @@
+//! Runtime CPU-feature dispatch for batched hashing kernels.
+//!
+//! Batch entry points (see [`super::hash::hash_labeled_batch`]) split their
+//! input into groups of `lane_width()` states so a vectorized permutation
+//! kernel can process one group per pass. The width is probed once per
+//! process: 8 lanes with AVX-512F, 4 with AVX2 on x86_64, 4 for NEON on
+//! aarch64, and 1 otherwise. The scalar kernel remains the deterministic
+//! reference for every width, so golden vectors are independent of the
+//! host CPU.
+
+use std::sync::OnceLock;
+
+static LANE_WIDTH: OnceLock<usize> = OnceLock::new();
+
+#[cfg(target_arch = "x86_64")]
+fn detect_lane_width() -> usize {
+    if is_x86_feature_detected!("avx512f") {
+        8
+    } else if is_x86_feature_detected!("avx2") {
+        4
+    } else {
+        1
+    }
+}
+
+#[cfg(target_arch = "aarch64")]
+fn detect_lane_width() -> usize {
+    // NEON is baseline on the aarch64 targets we ship.
+    4
+}
+
+#[cfg(not(any(target_arch = "x86_64", target_arch = "aarch64")))]
+fn detect_lane_width() -> usize {
+    1
+}
+
+/// Number of hash states a batched kernel processes per pass on this CPU.
+pub fn lane_width() -> usize {
+    *LANE_WIDTH.get_or_init(detect_lane_width)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn lane_width_is_stable_and_positive() {
+        let width = lane_width();
+        assert!(width >= 1);
+        assert_eq!(width, lane_width());
+    }
+}
@@ -1,6 +1,7 @@
 //! Hash-to-field for a 254-bit prime (BN254-like placeholder).
 //! We implement a simple wide-reduce from 256-bit (or 512-bit) digests.
 
+use crate::crypto::fp254::Fp254;
 use num_bigint::BigUint;
 use num_traits::One;
 
@@ -20,9 +21,10 @@ pub fn reduce_to_prime254(bytes: &[u8]) -> BigUint {
     x % p
 }
 
-/// Convenience: hash-to-field from a 32-byte digest (big-endian)
+/// Convenience: hash-to-field from a 32-byte digest (big-endian).
+/// Reduces through the fixed-limb [`Fp254`] type rather than `BigUint`.
 pub fn h2f_32_be(digest32: [u8; 32]) -> BigUint {
-    reduce_to_prime254(&digest32)
+    Fp254::from_bytes32_be(&digest32).to_biguint()
 }
 
 /// Convenience: hash-to-field from two concatenated 32-byte digests (64 bytes)
@@ -30,7 +32,7 @@ pub fn h2f_64_be(digest_a: [u8; 32], digest_b: [u8; 32]) -> BigUint {
     let mut v = [0u8; 64];
     v[..32].copy_from_slice(&digest_a);
     v[32..].copy_from_slice(&digest_b);
-    reduce_to_prime254(&v)
+    Fp254::from_bytes64_be(&v).to_biguint()
 }
 
 #[cfg(test)]
@@ -53,4 +55,17 @@ mod tests {
         assert!(ones < p);
         assert!(ones.bits() <= 254);
     }
+
+    #[test]
+    fn h2f_matches_biguint_reduction() {
+        let digest = [0xabu8; 32];
+        assert_eq!(h2f_32_be(digest), reduce_to_prime254(&digest));
+
+        let a = [0x17u8; 32];
+        let b = [0xf3u8; 32];
+        let mut wide = [0u8; 64];
+        wide[..32].copy_from_slice(&a);
+        wide[32..].copy_from_slice(&b);
+        assert_eq!(h2f_64_be(a, b), reduce_to_prime254(&wide));
+    }
 }
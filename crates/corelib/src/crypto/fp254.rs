@@ -0,0 +1,319 @@
+//! Fixed-limb arithmetic for the Prime254 field (2^254 - 127 * 2^120 + 1).
+//!
+//! Elements are four u64 limbs (little-endian) kept in Montgomery form, so a
+//! multiplication is one 256x256 schoolbook product plus a Montgomery
+//! reduction -- no heap allocation and no per-call modulus construction, in
+//! contrast to the `BigUint` helpers in [`super::field`]. Reductions use
+//! borrow-mask selection instead of data-dependent branches.
+
+use num_bigint::BigUint;
+
+/// The Prime254 modulus as little-endian limbs.
+pub const MODULUS: [u64; 4] = [
+    0x0000000000000001,
+    0x8100000000000000,
+    0xffffffffffffffff,
+    0x3fffffffffffffff,
+];
+
+/// `-MODULUS^-1 mod 2^64`, the Montgomery reduction constant.
+const INV: u64 = 0xffffffffffffffff;
+
+/// `2^256 mod p`, i.e. the Montgomery form of 1.
+const R: [u64; 4] = [
+    0xfffffffffffffffc,
+    0xfbffffffffffffff,
+    0x0000000000000001,
+    0x0000000000000000,
+];
+
+/// `(2^256)^2 mod p`, used to convert values into Montgomery form.
+const R2: [u64; 4] = [
+    0x0000000000000001,
+    0x9100000000000000,
+    0xfffffffffffffff7,
+    0x300fffffffffffff,
+];
+
+#[inline(always)]
+fn adc(a: u64, b: u64, carry: u64) -> (u64, u64) {
+    let t = u128::from(a) + u128::from(b) + u128::from(carry);
+    (t as u64, (t >> 64) as u64)
+}
+
+#[inline(always)]
+fn mac(a: u64, b: u64, c: u64, carry: u64) -> (u64, u64) {
+    let t = u128::from(a) + u128::from(b) * u128::from(c) + u128::from(carry);
+    (t as u64, (t >> 64) as u64)
+}
+
+/// A Prime254 field element in Montgomery form.
+#[derive(Clone, Copy, PartialEq, Eq, Debug, Default)]
+pub struct Fp254([u64; 4]);
+
+impl Fp254 {
+    /// The additive identity.
+    pub const fn zero() -> Self {
+        Fp254([0, 0, 0, 0])
+    }
+
+    /// The multiplicative identity.
+    pub const fn one() -> Self {
+        Fp254(R)
+    }
+
+    /// Lift a u64 into the field.
+    pub fn from_u64(value: u64) -> Self {
+        Fp254(mont_mul(&[value, 0, 0, 0], &R2))
+    }
+
+    /// Reduce a 32-byte big-endian value into the field.
+    pub fn from_bytes32_be(bytes: &[u8; 32]) -> Self {
+        let limbs = limbs_from_be(bytes);
+        Fp254(mont_mul(&limbs, &R2))
+    }
+
+    /// Reduce a 64-byte big-endian value into the field (wide reduction for
+    /// concatenated digests).
+    pub fn from_bytes64_be(bytes: &[u8; 64]) -> Self {
+        let hi: [u8; 32] = bytes[..32].try_into().unwrap();
+        let lo: [u8; 32] = bytes[32..].try_into().unwrap();
+        // value = hi * 2^256 + lo, and 2^256 === R (mod p): fold the high
+        // half in with one extra Montgomery multiplication by R^2.
+        let hi = mont_mul(&mont_mul(&limbs_from_be(&hi), &R2), &R2);
+        Fp254(hi) + Self::from_bytes32_be(&lo)
+    }
+
+    /// Canonical big-endian byte encoding of the element.
+    pub fn to_bytes_be(self) -> [u8; 32] {
+        // Multiplying by 1 performs the Montgomery reduction back to the
+        // canonical representative.
+        let limbs = mont_mul(&self.0, &[1, 0, 0, 0]);
+        let mut out = [0u8; 32];
+        for (i, limb) in limbs.iter().enumerate() {
+            out[32 - 8 * (i + 1)..32 - 8 * i].copy_from_slice(&limb.to_be_bytes());
+        }
+        out
+    }
+
+    /// Interop with the `BigUint`-based helpers in [`super::field`].
+    pub fn to_biguint(self) -> BigUint {
+        BigUint::from_bytes_be(&self.to_bytes_be())
+    }
+
+    /// Field addition.
+    pub fn add(self, rhs: Self) -> Self {
+        let mut out = [0u64; 4];
+        let mut carry = 0u64;
+        for i in 0..4 {
+            let (limb, c) = adc(self.0[i], rhs.0[i], carry);
+            out[i] = limb;
+            carry = c;
+        }
+        // p < 2^254, so the sum fits in 256 bits and one conditional
+        // subtraction restores the range.
+        Fp254(sub_modulus_if_needed(out))
+    }
+
+    /// Field subtraction.
+    pub fn sub(self, rhs: Self) -> Self {
+        let mut out = [0u64; 4];
+        let mut borrow = 0u64;
+        for i in 0..4 {
+            let t = u128::from(self.0[i])
+                .wrapping_sub(u128::from(rhs.0[i]) + u128::from(borrow));
+            out[i] = t as u64;
+            borrow = ((t >> 64) as u64) & 1;
+        }
+        // Add p back when the subtraction underflowed; `mask` is all-ones
+        // exactly then, keeping the selection free of branches.
+        let mask = borrow.wrapping_neg();
+        let mut carry = 0u64;
+        for i in 0..4 {
+            let (limb, c) = adc(out[i], MODULUS[i] & mask, carry);
+            out[i] = limb;
+            carry = c;
+        }
+        Fp254(out)
+    }
+
+    /// Additive inverse.
+    pub fn neg(self) -> Self {
+        Self::zero().sub(self)
+    }
+
+    /// Field multiplication.
+    pub fn mul(self, rhs: Self) -> Self {
+        Fp254(mont_mul(&self.0, &rhs.0))
+    }
+
+    /// Field squaring.
+    pub fn square(self) -> Self {
+        self.mul(self)
+    }
+}
+
+impl std::ops::Add for Fp254 {
+    type Output = Fp254;
+    fn add(self, rhs: Fp254) -> Fp254 {
+        Fp254::add(self, rhs)
+    }
+}
+
+impl std::ops::Sub for Fp254 {
+    type Output = Fp254;
+    fn sub(self, rhs: Fp254) -> Fp254 {
+        Fp254::sub(self, rhs)
+    }
+}
+
+impl std::ops::Mul for Fp254 {
+    type Output = Fp254;
+    fn mul(self, rhs: Fp254) -> Fp254 {
+        Fp254::mul(self, rhs)
+    }
+}
+
+fn limbs_from_be(bytes: &[u8; 32]) -> [u64; 4] {
+    let mut limbs = [0u64; 4];
+    for (i, limb) in limbs.iter_mut().enumerate() {
+        let chunk: [u8; 8] = bytes[32 - 8 * (i + 1)..32 - 8 * i].try_into().unwrap();
+        *limb = u64::from_be_bytes(chunk);
+    }
+    limbs
+}
+
+/// Subtract the modulus when `limbs >= p`, selected by borrow mask rather
+/// than a data-dependent branch.
+fn sub_modulus_if_needed(limbs: [u64; 4]) -> [u64; 4] {
+    let mut reduced = [0u64; 4];
+    let mut borrow = 0u64;
+    for i in 0..4 {
+        let t = u128::from(limbs[i]).wrapping_sub(u128::from(MODULUS[i]) + u128::from(borrow));
+        reduced[i] = t as u64;
+        borrow = ((t >> 64) as u64) & 1;
+    }
+    // borrow == 1 means limbs < p: keep the original value.
+    let keep = borrow.wrapping_neg();
+    let mut out = [0u64; 4];
+    for i in 0..4 {
+        out[i] = (limbs[i] & keep) | (reduced[i] & !keep);
+    }
+    out
+}
+
+/// CIOS Montgomery multiplication: returns `a * b * 2^-256 mod p`.
+fn mont_mul(a: &[u64; 4], b: &[u64; 4]) -> [u64; 4] {
+    let mut t = [0u64; 6];
+    for i in 0..4 {
+        let mut carry = 0u64;
+        for j in 0..4 {
+            let (limb, c) = mac(t[j], a[j], b[i], carry);
+            t[j] = limb;
+            carry = c;
+        }
+        let (limb, c) = adc(t[4], carry, 0);
+        t[4] = limb;
+        t[5] = c;
+
+        let m = t[0].wrapping_mul(INV);
+        let (_, mut carry) = mac(t[0], m, MODULUS[0], 0);
+        for j in 1..4 {
+            let (limb, c) = mac(t[j], m, MODULUS[j], carry);
+            t[j - 1] = limb;
+            carry = c;
+        }
+        let (limb, c) = adc(t[4], carry, 0);
+        t[3] = limb;
+        let (limb, _) = adc(t[5], c, 0);
+        t[4] = limb;
+        t[5] = 0;
+    }
+    sub_modulus_if_needed([t[0], t[1], t[2], t[3]])
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::crypto::field::prime254_modulus;
+
+    fn modulus() -> BigUint {
+        prime254_modulus()
+    }
+
+    /// Deterministic pseudo-random 32-byte values for parity checks.
+    fn sample_bytes(seed: u64) -> [u8; 32] {
+        let mut state = seed.wrapping_mul(0x9e3779b97f4a7c15).wrapping_add(1);
+        let mut out = [0u8; 32];
+        for chunk in out.chunks_mut(8) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            chunk.copy_from_slice(&state.to_be_bytes());
+        }
+        out
+    }
+
+    #[test]
+    fn constants_match_biguint_modulus() {
+        let mut bytes = [0u8; 32];
+        for (i, limb) in MODULUS.iter().enumerate() {
+            bytes[32 - 8 * (i + 1)..32 - 8 * i].copy_from_slice(&limb.to_be_bytes());
+        }
+        assert_eq!(BigUint::from_bytes_be(&bytes), modulus());
+        assert_eq!(Fp254::one().to_biguint(), BigUint::from(1u8));
+        assert_eq!(Fp254::zero().to_biguint(), BigUint::from(0u8));
+    }
+
+    #[test]
+    fn roundtrip_and_reduction_match_biguint() {
+        let p = modulus();
+        for seed in 0..32u64 {
+            let bytes = sample_bytes(seed);
+            let expected = BigUint::from_bytes_be(&bytes) % &p;
+            assert_eq!(Fp254::from_bytes32_be(&bytes).to_biguint(), expected);
+        }
+    }
+
+    #[test]
+    fn wide_reduction_matches_biguint() {
+        let p = modulus();
+        for seed in 0..32u64 {
+            let mut wide = [0u8; 64];
+            wide[..32].copy_from_slice(&sample_bytes(seed));
+            wide[32..].copy_from_slice(&sample_bytes(seed + 1000));
+            let expected = BigUint::from_bytes_be(&wide) % &p;
+            assert_eq!(Fp254::from_bytes64_be(&wide).to_biguint(), expected);
+        }
+    }
+
+    #[test]
+    fn arithmetic_matches_biguint() {
+        let p = modulus();
+        for seed in 0..32u64 {
+            let a_bytes = sample_bytes(seed);
+            let b_bytes = sample_bytes(seed + 5000);
+            let a = Fp254::from_bytes32_be(&a_bytes);
+            let b = Fp254::from_bytes32_be(&b_bytes);
+            let a_ref = BigUint::from_bytes_be(&a_bytes) % &p;
+            let b_ref = BigUint::from_bytes_be(&b_bytes) % &p;
+
+            assert_eq!((a + b).to_biguint(), (&a_ref + &b_ref) % &p);
+            assert_eq!(
+                (a - b).to_biguint(),
+                ((&p + &a_ref) - &b_ref) % &p,
+            );
+            assert_eq!((a * b).to_biguint(), (&a_ref * &b_ref) % &p);
+            assert_eq!(a.square().to_biguint(), (&a_ref * &a_ref) % &p);
+            assert_eq!((a.neg() + a).to_biguint(), BigUint::from(0u8));
+        }
+    }
+
+    #[test]
+    fn from_u64_and_identities() {
+        let a = Fp254::from_u64(12345);
+        assert_eq!(a.to_biguint(), BigUint::from(12345u32));
+        assert_eq!((a * Fp254::one()).to_biguint(), a.to_biguint());
+        assert_eq!((a + Fp254::zero()).to_biguint(), a.to_biguint());
+    }
+}
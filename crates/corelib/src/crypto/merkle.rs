@@ -4,13 +4,20 @@
 //! - node2: H("NODE2" || left || right)
 //! - node4: H("NODE4" || c0 || c1 || c2 || c3)
 
-use crate::crypto::hash::{hash_labeled, Hash32};
+use crate::crypto::hash::{hash_labeled, hash_labeled_batch, Hash32};
 
 /// Hash a leaf with the `"LEAF"` domain separator.
 pub fn leaf_hash<H: Hash32>(data: &[u8]) -> [u8; 32] {
     hash_labeled::<H>("LEAF", data)
 }
 
+/// Hash every leaf through the batched entry point, which feeds vectorized
+/// kernels when the CPU supports them.
+fn leaf_hashes<H: Hash32>(leaves: &[Vec<u8>]) -> Vec<[u8; 32]> {
+    let refs: Vec<&[u8]> = leaves.iter().map(|d| d.as_slice()).collect();
+    hash_labeled_batch::<H>("LEAF", &refs)
+}
+
 /// Hash a binary node with the `"NODE2"` domain separator.
 pub fn node2_hash<H: Hash32>(left: &[u8; 32], right: &[u8; 32]) -> [u8; 32] {
     let mut h = H::new();
@@ -39,7 +46,7 @@ pub fn node4_hash<H: Hash32>(
 /// Compute a Merkle root for an arity-2 tree.
 pub fn root_arity2<H: Hash32>(leaves: &[Vec<u8>]) -> [u8; 32] {
     assert!(!leaves.is_empty(), "no leaves");
-    let mut level: Vec<[u8; 32]> = leaves.iter().map(|d| leaf_hash::<H>(d)).collect();
+    let mut level: Vec<[u8; 32]> = leaf_hashes::<H>(leaves);
     while level.len() > 1 {
         let mut next = Vec::with_capacity(level.len().div_ceil(2));
         for chunk in level.chunks(2) {
@@ -59,7 +66,7 @@ pub fn root_arity2<H: Hash32>(leaves: &[Vec<u8>]) -> [u8; 32] {
 /// Compute a Merkle root for an arity-4 tree.
 pub fn root_arity4<H: Hash32>(leaves: &[Vec<u8>]) -> [u8; 32] {
     assert!(!leaves.is_empty(), "no leaves");
-    let mut level: Vec<[u8; 32]> = leaves.iter().map(|d| leaf_hash::<H>(d)).collect();
+    let mut level: Vec<[u8; 32]> = leaf_hashes::<H>(leaves);
     while level.len() > 1 {
         let mut next = Vec::with_capacity(level.len().div_ceil(4));
         for chunk in level.chunks(4) {
@@ -77,6 +84,275 @@ pub fn root_arity4<H: Hash32>(leaves: &[Vec<u8>]) -> [u8; 32] {
     level[0]
 }
 
+/// Parallelize a level only when it has enough nodes to amortize thread
+/// startup; smaller levels hash serially.
+const PARALLEL_THRESHOLD: usize = 1024;
+
+/// Whether a level of `items` nodes should hash across threads. Always false
+/// on wasm targets, where spawning traps — every level hashes serially there.
+fn parallel_level(items: usize) -> bool {
+    items >= PARALLEL_THRESHOLD && !cfg!(target_family = "wasm")
+}
+
+fn tree_thread_count(items: usize) -> usize {
+    let cores = std::thread::available_parallelism()
+        .map(|n| n.get())
+        .unwrap_or(1);
+    items.div_ceil(PARALLEL_THRESHOLD).clamp(1, cores)
+}
+
+/// An arity-2 Merkle tree stored as one flat preallocated node array, leaf
+/// hashes first and the root last, with every interior level retained for
+/// proof-path extraction.
+///
+/// [`MerkleTree2::build`] takes borrowed leaf slices (no per-leaf `Vec`) and
+/// hashes the leaf level and each interior level across threads; roots and
+/// proofs match [`root_arity2`] / [`prove_arity2`] exactly, including the
+/// duplicate-last handling for odd level sizes.
+pub struct MerkleTree2 {
+    nodes: Vec<[u8; 32]>,
+    level_offsets: Vec<usize>,
+    level_lens: Vec<usize>,
+}
+
+impl MerkleTree2 {
+    /// Build a tree over borrowed leaves.
+    pub fn build<H: Hash32>(leaves: &[&[u8]]) -> Self {
+        assert!(!leaves.is_empty(), "no leaves");
+
+        let mut level_lens = vec![leaves.len()];
+        while *level_lens.last().unwrap() > 1 {
+            level_lens.push(level_lens.last().unwrap().div_ceil(2));
+        }
+        let mut level_offsets = Vec::with_capacity(level_lens.len());
+        let mut total = 0usize;
+        for &len in &level_lens {
+            level_offsets.push(total);
+            total += len;
+        }
+
+        let mut nodes = vec![[0u8; 32]; total];
+
+        // Leaf level.
+        let leaf_len = leaves.len();
+        if parallel_level(leaf_len) {
+            let threads = tree_thread_count(leaf_len);
+            let chunk = leaf_len.div_ceil(threads);
+            std::thread::scope(|scope| {
+                for (out, input) in nodes[..leaf_len]
+                    .chunks_mut(chunk)
+                    .zip(leaves.chunks(chunk))
+                {
+                    scope.spawn(move || {
+                        for (slot, data) in out.iter_mut().zip(input) {
+                            *slot = leaf_hash::<H>(data);
+                        }
+                    });
+                }
+            });
+        } else {
+            for (slot, data) in nodes[..leaf_len].iter_mut().zip(leaves) {
+                *slot = leaf_hash::<H>(data);
+            }
+        }
+
+        // Interior levels: hash pairs of the previous level into the next,
+        // splitting the flat array so child and parent regions borrow
+        // disjointly.
+        for level in 1..level_lens.len() {
+            let child_offset = level_offsets[level - 1];
+            let child_len = level_lens[level - 1];
+            let parent_offset = level_offsets[level];
+            let parent_len = level_lens[level];
+
+            let (lower, upper) = nodes.split_at_mut(parent_offset);
+            let children = &lower[child_offset..child_offset + child_len];
+            let parents = &mut upper[..parent_len];
+
+            let fill = |parents: &mut [[u8; 32]], base: usize| {
+                for (i, slot) in parents.iter_mut().enumerate() {
+                    let left = 2 * (base + i);
+                    let right = left + 1;
+                    *slot = if right < child_len {
+                        node2_hash::<H>(&children[left], &children[right])
+                    } else {
+                        node2_hash::<H>(&children[left], &children[left])
+                    };
+                }
+            };
+
+            if parallel_level(parent_len) {
+                let threads = tree_thread_count(parent_len);
+                let chunk = parent_len.div_ceil(threads);
+                std::thread::scope(|scope| {
+                    for (idx, out) in parents.chunks_mut(chunk).enumerate() {
+                        scope.spawn(move || fill(out, idx * chunk));
+                    }
+                });
+            } else {
+                fill(parents, 0);
+            }
+        }
+
+        Self {
+            nodes,
+            level_offsets,
+            level_lens,
+        }
+    }
+
+    /// Number of leaves the tree was built over.
+    pub fn leaf_count(&self) -> usize {
+        self.level_lens[0]
+    }
+
+    /// The Merkle root.
+    pub fn root(&self) -> [u8; 32] {
+        *self.nodes.last().unwrap()
+    }
+
+    /// Extract an inclusion proof for `index` from the retained levels.
+    pub fn proof(&self, index: usize) -> Proof2 {
+        assert!(index < self.leaf_count());
+        let mut idx = index;
+        let mut path = Vec::with_capacity(self.level_lens.len() - 1);
+        for level in 0..self.level_lens.len() - 1 {
+            let offset = self.level_offsets[level];
+            let len = self.level_lens[level];
+            let is_right = idx % 2 == 1;
+            let sibling_idx = if is_right { idx - 1 } else { idx + 1 };
+            let sibling = if sibling_idx < len {
+                self.nodes[offset + sibling_idx]
+            } else {
+                self.nodes[offset + idx]
+            };
+            path.push((is_right, sibling));
+            idx /= 2;
+        }
+        Proof2 { path }
+    }
+}
+
+/// Borrowed-slice variant of [`root_arity2`]: no per-leaf `Vec` required.
+pub fn root_arity2_slices<H: Hash32>(leaves: &[&[u8]]) -> [u8; 32] {
+    MerkleTree2::build::<H>(leaves).root()
+}
+
+/// Streaming arity-2 Merkle accumulator with O(log n) append and root.
+///
+/// Appended leaves are folded into cached perfect-subtree peaks (one per set
+/// bit of the leaf count), so committing a new record never re-hashes
+/// history. [`MerkleAccumulator2::root`] bags the peaks right-to-left,
+/// duplicating the incomplete fringe exactly like [`root_arity2`], so the
+/// accumulator root equals the batch root for every leaf count. The peak
+/// state can be snapshotted to bytes and restored, letting commitments
+/// survive process restarts.
+pub struct MerkleAccumulator2<H: Hash32> {
+    count: u64,
+    /// `(height, subtree root)` pairs with strictly decreasing heights.
+    peaks: Vec<(u32, [u8; 32])>,
+    _hash: std::marker::PhantomData<H>,
+}
+
+impl<H: Hash32> MerkleAccumulator2<H> {
+    /// An empty accumulator.
+    pub fn new() -> Self {
+        Self {
+            count: 0,
+            peaks: Vec::new(),
+            _hash: std::marker::PhantomData,
+        }
+    }
+
+    /// Number of leaves appended so far.
+    pub fn len(&self) -> u64 {
+        self.count
+    }
+
+    /// Whether no leaves have been appended.
+    pub fn is_empty(&self) -> bool {
+        self.count == 0
+    }
+
+    /// Append one leaf, merging equal-height peaks (binary-counter style).
+    pub fn append(&mut self, leaf: &[u8]) {
+        let mut carry = (0u32, leaf_hash::<H>(leaf));
+        while let Some(&(height, peak)) = self.peaks.last() {
+            if height != carry.0 {
+                break;
+            }
+            self.peaks.pop();
+            carry = (height + 1, node2_hash::<H>(&peak, &carry.1));
+        }
+        self.peaks.push(carry);
+        self.count += 1;
+    }
+
+    /// Current root, or `None` when empty. Matches [`root_arity2`] over the
+    /// same leaves in the same order.
+    pub fn root(&self) -> Option<[u8; 32]> {
+        let mut iter = self.peaks.iter().rev();
+        let &(mut acc_height, mut acc) = iter.next()?;
+        for &(height, peak) in iter {
+            // Promote the incomplete right fringe by duplicating it, the
+            // same rule root_arity2 applies to odd level sizes.
+            while acc_height < height {
+                acc = node2_hash::<H>(&acc, &acc);
+                acc_height += 1;
+            }
+            acc = node2_hash::<H>(&peak, &acc);
+            acc_height = height + 1;
+        }
+        Some(acc)
+    }
+
+    /// Serialize the peak state: 8-byte little-endian leaf count followed by
+    /// the peaks from highest to lowest.
+    pub fn snapshot(&self) -> Vec<u8> {
+        let mut out = Vec::with_capacity(8 + 32 * self.peaks.len());
+        out.extend_from_slice(&self.count.to_le_bytes());
+        for (_, peak) in &self.peaks {
+            out.extend_from_slice(peak);
+        }
+        out
+    }
+
+    /// Restore an accumulator from [`MerkleAccumulator2::snapshot`] bytes.
+    /// Returns `None` when the byte length does not match the encoded count.
+    pub fn restore(bytes: &[u8]) -> Option<Self> {
+        if bytes.len() < 8 {
+            return None;
+        }
+        let count = u64::from_le_bytes(bytes[0..8].try_into().ok()?);
+        let expected_peaks = count.count_ones() as usize;
+        if bytes.len() != 8 + 32 * expected_peaks {
+            return None;
+        }
+
+        // Peak heights are exactly the set bits of the count, highest first.
+        let mut heights: Vec<u32> = (0..64).filter(|&h| count & (1u64 << h) != 0).collect();
+        heights.reverse();
+
+        let mut peaks = Vec::with_capacity(expected_peaks);
+        for (i, height) in heights.into_iter().enumerate() {
+            let start = 8 + 32 * i;
+            let peak: [u8; 32] = bytes[start..start + 32].try_into().ok()?;
+            peaks.push((height, peak));
+        }
+        Some(Self {
+            count,
+            peaks,
+            _hash: std::marker::PhantomData,
+        })
+    }
+}
+
+impl<H: Hash32> Default for MerkleAccumulator2<H> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
 /// Very simple inclusion proof for arity-2: a list of `(is_right, sibling)` pairs.
 pub struct Proof2 {
     pub path: Vec<(bool, [u8; 32])>,
@@ -86,7 +362,7 @@ pub struct Proof2 {
 pub fn prove_arity2<H: Hash32>(leaves: &[Vec<u8>], index: usize) -> Proof2 {
     assert!(index < leaves.len());
     let mut idx = index;
-    let mut level: Vec<[u8; 32]> = leaves.iter().map(|d| leaf_hash::<H>(d)).collect();
+    let mut level: Vec<[u8; 32]> = leaf_hashes::<H>(leaves);
     let mut path = Vec::new();
     while level.len() > 1 {
         let is_right = idx % 2 == 1;
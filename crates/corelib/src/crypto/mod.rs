@@ -4,7 +4,9 @@
 //! use in stubs.
 
 pub mod blake3;
+pub mod dispatch;
 pub mod field;
+pub mod fp254;
 pub mod hash;
 pub mod keccak;
 pub mod merkle;
@@ -1,7 +1,7 @@
 //! String-id -> Hash32 mapping and convenience helpers.
 
 use crate::crypto::blake3::Blake3;
-use crate::crypto::hash::hash_labeled;
+use crate::crypto::hash::{hash_labeled, hash_many};
 use crate::crypto::keccak::Keccak256;
 use crate::crypto::poseidon2::Poseidon2;
 use crate::crypto::rescue::Rescue;
@@ -10,26 +10,82 @@ fn normalize(id: &str) -> String {
     id.trim().to_ascii_lowercase()
 }
 
+/// Interned hash id: resolve the string once, dispatch through the enum
+/// thereafter so hot loops pay no per-element string lookup.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum HashId {
+    Blake3,
+    Keccak256,
+    Poseidon2,
+    Rescue,
+}
+
+impl HashId {
+    /// Resolve a string id (case- and whitespace-insensitive), or `None`
+    /// for unsupported ids.
+    pub fn resolve(id: &str) -> Option<Self> {
+        match normalize(id).as_str() {
+            "blake3" => Some(Self::Blake3),
+            "keccak256" => Some(Self::Keccak256),
+            "poseidon2" => Some(Self::Poseidon2),
+            "rescue" => Some(Self::Rescue),
+            _ => None,
+        }
+    }
+
+    /// Canonical string id.
+    pub fn as_str(self) -> &'static str {
+        match self {
+            Self::Blake3 => "blake3",
+            Self::Keccak256 => "keccak256",
+            Self::Poseidon2 => "poseidon2",
+            Self::Rescue => "rescue",
+        }
+    }
+
+    /// H(label || data).
+    pub fn hash32(self, label: &str, data: &[u8]) -> [u8; 32] {
+        match self {
+            Self::Blake3 => hash_labeled::<Blake3>(label, data),
+            Self::Keccak256 => hash_labeled::<Keccak256>(label, data),
+            Self::Poseidon2 => hash_labeled::<Poseidon2>(label, data),
+            Self::Rescue => hash_labeled::<Rescue>(label, data),
+        }
+    }
+
+    /// One-shot H(label || parts[0] || parts[1] ...), one hasher state.
+    pub fn hash_many(self, label: &str, parts: &[&[u8]]) -> [u8; 32] {
+        match self {
+            Self::Blake3 => hash_many::<Blake3>(label, parts),
+            Self::Keccak256 => hash_many::<Keccak256>(label, parts),
+            Self::Poseidon2 => hash_many::<Poseidon2>(label, parts),
+            Self::Rescue => hash_many::<Rescue>(label, parts),
+        }
+    }
+
+    /// First 8 bytes of [`HashId::hash32`] as a little-endian u64.
+    pub fn hash64(self, label: &str, data: &[u8]) -> u64 {
+        truncate64(self.hash32(label, data))
+    }
+}
+
+fn truncate64(digest: [u8; 32]) -> u64 {
+    let mut bytes = [0u8; 8];
+    bytes.copy_from_slice(&digest[0..8]);
+    u64::from_le_bytes(bytes)
+}
+
 /// Return H(label || data) for the given hash id.
 ///
-/// Supported ids: "blake3", "keccak256", "poseidon2", "rescue".
+/// Supported ids: "blake3", "keccak256", "poseidon2", "rescue". One-off
+/// callers can stay on this; loops should resolve a [`HashId`] once instead.
 pub fn hash32_by_id(id: &str, label: &str, data: &[u8]) -> Option<[u8; 32]> {
-    match normalize(id).as_str() {
-        "blake3" => Some(hash_labeled::<Blake3>(label, data)),
-        "keccak256" => Some(hash_labeled::<Keccak256>(label, data)),
-        "poseidon2" => Some(hash_labeled::<Poseidon2>(label, data)),
-        "rescue" => Some(hash_labeled::<Rescue>(label, data)),
-        _ => None,
-    }
+    HashId::resolve(id).map(|h| h.hash32(label, data))
 }
 
 /// Convenience helper deriving a u64 from the first 8 bytes (little-endian).
 pub fn hash64_by_id(id: &str, label: &str, data: &[u8]) -> Option<u64> {
-    hash32_by_id(id, label, data).map(|digest| {
-        let mut bytes = [0u8; 8];
-        bytes.copy_from_slice(&digest[0..8]);
-        u64::from_le_bytes(bytes)
-    })
+    hash32_by_id(id, label, data).map(truncate64)
 }
 
 #[cfg(test)]
@@ -50,6 +106,29 @@ mod tests {
         assert!(hash64_by_id("unknown", "LBL", b"data").is_none());
     }
 
+    #[test]
+    fn interned_id_matches_string_lookup() {
+        for id in ["blake3", "keccak256", "poseidon2", "rescue"] {
+            let interned = HashId::resolve(id).unwrap();
+            assert_eq!(interned.as_str(), id);
+            assert_eq!(
+                Some(interned.hash32("LBL", b"data")),
+                hash32_by_id(id, "LBL", b"data")
+            );
+            assert_eq!(
+                Some(interned.hash64("LBL", b"data")),
+                hash64_by_id(id, "LBL", b"data")
+            );
+            // One-shot multi-buffer hashing equals hashing the concatenation.
+            assert_eq!(
+                interned.hash_many("LBL", &[b"da", b"ta"]),
+                interned.hash32("LBL", b"data")
+            );
+        }
+        assert_eq!(HashId::resolve(" Blake3 "), Some(HashId::Blake3));
+        assert!(HashId::resolve("unknown").is_none());
+    }
+
     #[test]
     fn registry_hashes_are_distinct() {
         let blake = hash32_by_id("blake3", "LBL", b"data").unwrap();
@@ -21,6 +21,30 @@ sol! {
     struct EvmProofBody {
         bytes data;
     }
+
+    /// Shared header for a proof batch: fields identical across every proof
+    /// (one AIR, one profile), paid for once per calldata blob.
+    struct EvmBatchHeader {
+        uint64 backendId;
+        uint64 profileId;
+        uint32 count;
+    }
+
+    /// Per-proof fields of a batch. `publicIoSuffix` is the public IO JSON
+    /// minus the batch-wide common prefix carried in the container.
+    struct EvmBatchEntry {
+        uint64 pubioHash;
+        uint64 bodyLen;
+        bytes publicIoSuffix;
+        bytes body;
+    }
+
+    /// ABI container packing N proofs into one verification call.
+    struct EvmProofBatch {
+        EvmBatchHeader header;
+        bytes publicIoPrefix;
+        EvmBatchEntry[] entries;
+    }
 }
 
 pub fn encode_meta(header: &ProofHeader) -> Vec<u8> {
@@ -62,3 +86,101 @@ pub fn decode_public_io(data: &[u8]) -> Result<String> {
     let decoded = <EvmPublicIO as SolType>::abi_decode(data)?;
     String::from_utf8(decoded.data.to_vec()).map_err(|e| anyhow!(e))
 }
+
+/// Longest byte prefix shared by every public IO string in the batch.
+fn common_prefix_len(proofs: &[(ProofHeader, &str, &[u8])]) -> usize {
+    let first = proofs[0].1.as_bytes();
+    let mut len = first.len();
+    for (_, io, _) in &proofs[1..] {
+        len = len.min(
+            first
+                .iter()
+                .zip(io.as_bytes())
+                .take_while(|(a, b)| a == b)
+                .count(),
+        );
+    }
+    len
+}
+
+/// Encode N proofs sharing one AIR and profile as a single calldata blob.
+///
+/// Each proof is `(header, public_io_json, body)`. The backend and profile
+/// hashes are emitted once in the shared header, and the common prefix of the
+/// public IO strings (for rollup batches, typically everything but a few
+/// trailing fields) is emitted once and stripped from every entry. Fails if
+/// the batch is empty, if any header disagrees on backend or profile, or if a
+/// header's `body_len` does not match its body.
+pub fn encode_batch(proofs: &[(ProofHeader, &str, &[u8])]) -> Result<Vec<u8>> {
+    let (first, _, _) = proofs
+        .first()
+        .ok_or_else(|| anyhow!("batch must contain at least one proof"))?;
+    for (i, (header, _, body)) in proofs.iter().enumerate() {
+        if header.backend_id_hash != first.backend_id_hash
+            || header.profile_id_hash != first.profile_id_hash
+        {
+            return Err(anyhow!(
+                "batch entry {} has a different backend/profile than entry 0",
+                i
+            ));
+        }
+        if header.body_len != body.len() as u64 {
+            return Err(anyhow!(
+                "batch entry {}: body_len {} does not match body ({} bytes)",
+                i,
+                header.body_len,
+                body.len()
+            ));
+        }
+    }
+
+    let prefix_len = common_prefix_len(proofs);
+    let batch = EvmProofBatch {
+        header: EvmBatchHeader {
+            backendId: first.backend_id_hash,
+            profileId: first.profile_id_hash,
+            count: proofs.len() as u32,
+        },
+        publicIoPrefix: proofs[0].1.as_bytes()[..prefix_len].to_vec().into(),
+        entries: proofs
+            .iter()
+            .map(|(header, io, body)| EvmBatchEntry {
+                pubioHash: header.pubio_hash,
+                bodyLen: header.body_len,
+                publicIoSuffix: io.as_bytes()[prefix_len..].to_vec().into(),
+                body: body.to_vec().into(),
+            })
+            .collect(),
+    };
+    Ok(batch.abi_encode())
+}
+
+/// Decode a batch blob back to per-proof `(header, public_io_json, body)`
+/// triples, reinflating each public IO from the shared prefix and rebuilding
+/// full headers from the shared backend/profile hashes.
+pub fn decode_batch(data: &[u8]) -> Result<Vec<(ProofHeader, String, Vec<u8>)>> {
+    let batch = <EvmProofBatch as SolType>::abi_decode(data)?;
+    if batch.entries.len() != batch.header.count as usize {
+        return Err(anyhow!(
+            "batch count {} does not match {} entries",
+            batch.header.count,
+            batch.entries.len()
+        ));
+    }
+    batch
+        .entries
+        .into_iter()
+        .map(|entry| {
+            let mut io = batch.publicIoPrefix.to_vec();
+            io.extend_from_slice(&entry.publicIoSuffix);
+            let io = String::from_utf8(io).map_err(|e| anyhow!(e))?;
+            let header = ProofHeader {
+                backend_id_hash: batch.header.backendId,
+                profile_id_hash: batch.header.profileId,
+                pubio_hash: entry.pubioHash,
+                body_len: entry.bodyLen,
+            };
+            Ok((header, io, entry.body.to_vec()))
+        })
+        .collect()
+}
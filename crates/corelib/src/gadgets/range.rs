@@ -1,9 +1,36 @@
 //! Range-check utilities (Phase-0).
 //! - k-bit checks for u64 values
 //! - batch helpers
+//! - lookup-table mode: one table probe per limb instead of one constraint
+//!   per bit, for range-heavy programs
 
 use anyhow::{anyhow, Result};
 
+/// Default limb width for lookup-mode range checks: a 256-entry table keeps
+/// the table commitment trivial while cutting a 64-bit check from 64 bit
+/// constraints to 8 probes.
+pub const DEFAULT_LOOKUP_TABLE_BITS: u32 = 8;
+
+/// How a range check is realized in constraints.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum RangeCheckMode {
+    /// One boolean constraint per bit: O(k) per value.
+    BitDecomposition,
+    /// One probe into a `[0, 2^table_bits)` table per limb:
+    /// O(k / table_bits) per value.
+    Lookup { table_bits: u32 },
+}
+
+impl RangeCheckMode {
+    /// Constraint/probe count this mode spends on one `k`-bit check.
+    pub fn cost_per_value(&self, k: u32) -> u32 {
+        match self {
+            RangeCheckMode::BitDecomposition => k,
+            RangeCheckMode::Lookup { table_bits } => k.div_ceil(*table_bits),
+        }
+    }
+}
+
 /// Ensure `x` fits within `k` bits (1..=64). Returns Ok(()) or error with message.
 pub fn range_check_u64(x: u64, k: u32) -> Result<()> {
     if !(1..=64).contains(&k) {
@@ -27,3 +54,89 @@ pub fn range_check_slice_u64(xs: &[u64], k: u32) -> Result<()> {
     }
     Ok(())
 }
+
+/// Lookup table for `[0, 2^bits)` with per-row multiplicity counts.
+///
+/// `check` decomposes a value into `bits`-wide limbs and probes the table
+/// once per limb, recording multiplicities — the witness the lookup argument
+/// commits to alongside the table. The top limb of a `k`-bit check probes a
+/// truncated view of the table, which here reduces to the same bound check
+/// the decomposition already guarantees.
+#[derive(Debug, Clone)]
+pub struct LookupRangeTable {
+    bits: u32,
+    multiplicities: Vec<u64>,
+}
+
+impl LookupRangeTable {
+    /// Build a table for `bits`-wide limbs (1..=16; larger tables stop
+    /// paying for themselves against the per-limb probe cost).
+    pub fn new(bits: u32) -> Result<Self> {
+        if !(1..=16).contains(&bits) {
+            return Err(anyhow!(
+                "lookup range table: bits={} out of bounds [1..=16]",
+                bits
+            ));
+        }
+        Ok(Self {
+            bits,
+            multiplicities: vec![0; 1usize << bits],
+        })
+    }
+
+    /// Limb width of this table.
+    pub fn bits(&self) -> u32 {
+        self.bits
+    }
+
+    /// Probes `check` performs per `k`-bit value.
+    pub fn probes_per_value(&self, k: u32) -> u32 {
+        k.div_ceil(self.bits)
+    }
+
+    /// Ensure `x` fits within `k` bits via table probes, recording one
+    /// multiplicity per limb.
+    pub fn check(&mut self, x: u64, k: u32) -> Result<()> {
+        if !(1..=64).contains(&k) {
+            return Err(anyhow!("range_check: k={} out of bounds [1..=64]", k));
+        }
+        if k < 64 && (x >> k) != 0 {
+            return Err(anyhow!(
+                "range_check: value {} does not fit in {} bits",
+                x,
+                k
+            ));
+        }
+        let mask = (1u64 << self.bits) - 1;
+        for limb_idx in 0..self.probes_per_value(k) {
+            let limb = (x >> (limb_idx * self.bits)) & mask;
+            self.multiplicities[limb as usize] += 1;
+        }
+        Ok(())
+    }
+
+    /// Per-row probe counts accumulated so far.
+    pub fn multiplicities(&self) -> &[u64] {
+        &self.multiplicities
+    }
+
+    /// Total probes accumulated so far.
+    pub fn total_probes(&self) -> u64 {
+        self.multiplicities.iter().sum()
+    }
+}
+
+/// Batch range check under an explicit mode. Bit-decomposition mode matches
+/// [`range_check_slice_u64`]; lookup mode probes one shared table.
+pub fn range_check_slice_u64_with(xs: &[u64], k: u32, mode: RangeCheckMode) -> Result<()> {
+    match mode {
+        RangeCheckMode::BitDecomposition => range_check_slice_u64(xs, k),
+        RangeCheckMode::Lookup { table_bits } => {
+            let mut table = LookupRangeTable::new(table_bits)?;
+            for &x in xs {
+                table.check(x, k)?;
+            }
+            Ok(())
+        }
+    }
+}
@@ -19,6 +19,14 @@ pub struct Profile {
     pub const_col_limit: Option<u32>,
     #[serde(default)]
     pub rows_max: Option<u32>,
+    /// Cap on prover worker threads; `None` means all available cores.
+    #[serde(default)]
+    pub max_threads: Option<u32>,
+    /// Hard cap on per-proof trace memory in MiB; `None` means unbounded.
+    /// Intended for low-RAM targets (mobile bindings) where exceeding the
+    /// budget means the OOM killer, not swap.
+    #[serde(default)]
+    pub max_memory_mib: Option<u64>,
 }
 
 impl Profile {
@@ -52,8 +60,35 @@ impl Profile {
                 return Err(anyhow!("grind_bits {} too large (>64)", g));
             }
         }
+        if let Some(t) = self.max_threads {
+            if t == 0 {
+                return Err(anyhow!("max_threads must be >= 1 when set"));
+            }
+        }
+        if let Some(m) = self.max_memory_mib {
+            if m == 0 {
+                return Err(anyhow!("max_memory_mib must be >= 1 when set"));
+            }
+        }
         Ok(())
     }
+
+    /// Worker threads to use under this profile: available cores, clamped by
+    /// `max_threads` when the profile sets one.
+    pub fn effective_threads(&self) -> usize {
+        let cores = std::thread::available_parallelism()
+            .map(|n| n.get())
+            .unwrap_or(1);
+        match self.max_threads {
+            Some(cap) => cores.min(cap as usize).max(1),
+            None => cores,
+        }
+    }
+
+    /// The memory cap in bytes, when the profile sets one.
+    pub fn memory_budget_bytes(&self) -> Option<u64> {
+        self.max_memory_mib.map(|m| m * 1024 * 1024)
+    }
 }
 
 fn profiles_dir() -> PathBuf {
@@ -80,6 +115,8 @@ fn builtin_profiles() -> Vec<Profile> {
             merkle_arity: Some(2),
             const_col_limit: None,
             rows_max: None,
+            max_threads: None,
+            max_memory_mib: None,
         },
         Profile {
             id: "dev-fast".to_string(),
@@ -90,6 +127,8 @@ fn builtin_profiles() -> Vec<Profile> {
             merkle_arity: Some(2),
             const_col_limit: None,
             rows_max: None,
+            max_threads: None,
+            max_memory_mib: None,
         },
         Profile {
             id: "secure".to_string(),
@@ -100,6 +139,8 @@ fn builtin_profiles() -> Vec<Profile> {
             merkle_arity: Some(2),
             const_col_limit: None,
             rows_max: None,
+            max_threads: None,
+            max_memory_mib: None,
         },
     ];
     profiles.sort_by(|a, b| a.id.cmp(&b.id));
@@ -128,6 +169,12 @@ pub fn load_all_profiles() -> Result<Vec<Profile>> {
     Ok(out)
 }
 
+/// Look up one profile by id, falling back to the builtins when the
+/// /profiles directory is absent or unreadable.
+pub fn find_profile(id: &str) -> Option<Profile> {
+    load_all_profiles_or_default().into_iter().find(|p| p.id == id)
+}
+
 pub fn load_all_profiles_or_default() -> Vec<Profile> {
     load_all_profiles().unwrap_or_else(|e| {
         eprintln!("WARN: failed to load profiles: {e}");
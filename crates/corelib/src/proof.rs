@@ -14,6 +14,15 @@ use crate::crypto::registry;
 /// Magic/version
 pub const MAGIC: [u8; 4] = *b"PROF";
 pub const VERSION: u32 = 1;
+/// Version 2 adds a section table between the header and the payload so a
+/// verifier can memory-map a proof file and touch only the sections it needs.
+pub const VERSION_SECTIONED: u32 = 2;
+
+/// Well-known section ids for version-2 proofs.
+pub const SECTION_PUBIO: u32 = 1;
+pub const SECTION_COMMITMENTS: u32 = 2;
+pub const SECTION_FRI: u32 = 3;
+pub const SECTION_OPENINGS: u32 = 4;
 
 /// Fixed-size header (little endian).
 /// Layout (bytes):
@@ -33,9 +42,15 @@ pub struct ProofHeader {
 
 impl ProofHeader {
     pub fn encode(&self) -> [u8; 40] {
+        self.encode_versioned(VERSION)
+    }
+
+    /// Encode with an explicit format version (1 or 2); the layout of the 40
+    /// header bytes is identical in both.
+    pub fn encode_versioned(&self, version: u32) -> [u8; 40] {
         let mut out = [0u8; 40];
         out[0..4].copy_from_slice(&MAGIC);
-        out[4..8].copy_from_slice(&VERSION.to_le_bytes());
+        out[4..8].copy_from_slice(&version.to_le_bytes());
         out[8..16].copy_from_slice(&self.backend_id_hash.to_le_bytes());
         out[16..24].copy_from_slice(&self.profile_id_hash.to_le_bytes());
         out[24..32].copy_from_slice(&self.pubio_hash.to_le_bytes());
@@ -51,7 +66,7 @@ impl ProofHeader {
             bail!("bad magic");
         }
         let ver = u32::from_le_bytes(bytes[4..8].try_into().unwrap());
-        if ver != VERSION {
+        if ver != VERSION && ver != VERSION_SECTIONED {
             bail!("unsupported proof version {ver}");
         }
         let backend_id_hash = u64::from_le_bytes(bytes[8..16].try_into().unwrap());
@@ -81,3 +96,149 @@ pub fn assemble_proof(header: &ProofHeader, body: &[u8]) -> Vec<u8> {
     v.extend_from_slice(body);
     v
 }
+
+/// Proof format version of an encoded proof, without full decoding.
+pub fn proof_version(bytes: &[u8]) -> Result<u32> {
+    if bytes.len() < 8 {
+        bail!("proof too short for header");
+    }
+    if bytes[0..4] != MAGIC {
+        bail!("bad magic");
+    }
+    Ok(u32::from_le_bytes(bytes[4..8].try_into().unwrap()))
+}
+
+/// One entry of a version-2 section table (little endian, 32 bytes).
+/// Layout: id (u32), reserved (u32, zero), offset (u64, from the start of the
+/// proof), len (u64), checksum (u64, `hash64("SECTION", payload)`).
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct SectionEntry {
+    pub id: u32,
+    pub offset: u64,
+    pub len: u64,
+    pub checksum: u64,
+}
+
+const SECTION_ENTRY_LEN: usize = 32;
+
+/// Encode a version-2 proof: header(40) + count(u32) + table + payloads.
+///
+/// `header.body_len` is overwritten with everything after the header (table
+/// and payloads), keeping the existing length check meaningful. Section
+/// payloads are laid out in the order given, each independently addressable
+/// through its table entry.
+pub fn assemble_proof_sectioned(header: &ProofHeader, sections: &[(u32, &[u8])]) -> Vec<u8> {
+    let table_len = 4 + sections.len() * SECTION_ENTRY_LEN;
+    let payload_len: usize = sections.iter().map(|(_, s)| s.len()).sum();
+
+    let mut header = header.clone();
+    header.body_len = (table_len + payload_len) as u64;
+
+    let mut v = Vec::with_capacity(40 + table_len + payload_len);
+    v.extend_from_slice(&header.encode_versioned(VERSION_SECTIONED));
+    v.extend_from_slice(&(sections.len() as u32).to_le_bytes());
+
+    let mut offset = (40 + table_len) as u64;
+    for (id, payload) in sections {
+        v.extend_from_slice(&id.to_le_bytes());
+        v.extend_from_slice(&0u32.to_le_bytes());
+        v.extend_from_slice(&offset.to_le_bytes());
+        v.extend_from_slice(&(payload.len() as u64).to_le_bytes());
+        v.extend_from_slice(&hash64("SECTION", payload).to_le_bytes());
+        offset += payload.len() as u64;
+    }
+    for (_, payload) in sections {
+        v.extend_from_slice(payload);
+    }
+    v
+}
+
+/// Zero-copy reader over an encoded proof, version 1 or 2.
+///
+/// Borrows the underlying bytes (a `Vec`, an mmap'd file, anything `&[u8]`)
+/// and never copies payloads: opening parses only the header and, for
+/// version 2, the section table; section checksums are verified lazily on
+/// access so untouched sections are never faulted in.
+pub struct ProofReader<'a> {
+    bytes: &'a [u8],
+    header: ProofHeader,
+    version: u32,
+    entries: Vec<SectionEntry>,
+}
+
+impl<'a> ProofReader<'a> {
+    pub fn open(bytes: &'a [u8]) -> Result<Self> {
+        let header = ProofHeader::decode(bytes)?;
+        let version = proof_version(bytes)?;
+        if bytes.len() as u64 != 40 + header.body_len {
+            bail!("body length mismatch");
+        }
+
+        let mut entries = Vec::new();
+        if version == VERSION_SECTIONED {
+            if header.body_len < 4 {
+                bail!("sectioned proof too short for table");
+            }
+            let count = u32::from_le_bytes(bytes[40..44].try_into().unwrap()) as usize;
+            let table_end = 44 + count * SECTION_ENTRY_LEN;
+            if bytes.len() < table_end {
+                bail!("sectioned proof too short for {count} table entries");
+            }
+            for i in 0..count {
+                let e = &bytes[44 + i * SECTION_ENTRY_LEN..44 + (i + 1) * SECTION_ENTRY_LEN];
+                let entry = SectionEntry {
+                    id: u32::from_le_bytes(e[0..4].try_into().unwrap()),
+                    offset: u64::from_le_bytes(e[8..16].try_into().unwrap()),
+                    len: u64::from_le_bytes(e[16..24].try_into().unwrap()),
+                    checksum: u64::from_le_bytes(e[24..32].try_into().unwrap()),
+                };
+                let end = entry
+                    .offset
+                    .checked_add(entry.len)
+                    .ok_or_else(|| anyhow::anyhow!("section {} overflows", entry.id))?;
+                if entry.offset < table_end as u64 || end > bytes.len() as u64 {
+                    bail!("section {} out of bounds", entry.id);
+                }
+                entries.push(entry);
+            }
+        }
+
+        Ok(Self {
+            bytes,
+            header,
+            version,
+            entries,
+        })
+    }
+
+    pub fn header(&self) -> &ProofHeader {
+        &self.header
+    }
+
+    pub fn version(&self) -> u32 {
+        self.version
+    }
+
+    /// Table entries in file order (empty for version-1 proofs).
+    pub fn sections(&self) -> &[SectionEntry] {
+        &self.entries
+    }
+
+    /// Raw body after the header; for version 2 this includes the table.
+    pub fn body(&self) -> &'a [u8] {
+        &self.bytes[40..]
+    }
+
+    /// Payload of section `id`, verifying only that section's checksum.
+    /// `Ok(None)` when the section is absent.
+    pub fn section(&self, id: u32) -> Result<Option<&'a [u8]>> {
+        let Some(entry) = self.entries.iter().find(|e| e.id == id) else {
+            return Ok(None);
+        };
+        let payload = &self.bytes[entry.offset as usize..(entry.offset + entry.len) as usize];
+        if hash64("SECTION", payload) != entry.checksum {
+            bail!("section {} checksum mismatch", id);
+        }
+        Ok(Some(payload))
+    }
+}
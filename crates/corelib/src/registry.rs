@@ -80,8 +80,8 @@ impl ProverBackend for NativeBuiltinBackend {
             fields: vec!["Prime254"],
             hashes: vec!["blake3", "keccak256", "poseidon2", "rescue"],
             fri_arities: vec![2, 4],
-            recursion: "none",
-            lookups: false,
+            recursion: "stark-in-stark",
+            lookups: true,
             curves: vec!["placeholder"],
             pedersen: true,
         }
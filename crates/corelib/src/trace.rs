@@ -1,6 +1,8 @@
-//! Trace shape derived from AIR and/or profile hints.
+//! Trace shape derived from AIR and/or profile hints, plus the column-major
+//! trace storage backends fill during proving.
 
 use crate::air::AirProgram;
+use crate::crypto::fp254::Fp254;
 
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub struct TraceShape {
@@ -22,4 +24,216 @@ impl TraceShape {
             periodic_cols: air.columns.periodic_cols,
         }
     }
+
+    /// Total column count across the main, constant, and periodic segments.
+    pub fn total_cols(&self) -> u32 {
+        self.cols + self.const_cols + self.periodic_cols
+    }
+
+    /// Bytes a [`TraceBuffer`] of this shape will allocate, before any LDE
+    /// blowup. Computed in u64 so oversized shapes project correctly even on
+    /// 32-bit targets.
+    pub fn projected_bytes(&self) -> u64 {
+        self.rows as u64 * self.total_cols() as u64 * std::mem::size_of::<Fp254>() as u64
+    }
+}
+
+/// Cache-line-sized arena block keeping the trace storage 64-byte aligned.
+#[repr(C, align(64))]
+#[derive(Clone, Copy)]
+struct AlignedBlock([u8; 64]);
+
+/// Parallelize a fill only when a column has enough rows to amortize thread
+/// startup.
+const FILL_PARALLEL_THRESHOLD: usize = 1024;
+
+/// Column-major trace storage for one proof.
+///
+/// All columns live in a single 64-byte-aligned arena allocated once from a
+/// [`TraceShape`] (columns ordered main, then constant, then periodic), so
+/// constraint evaluation iterates each column contiguously and no per-column
+/// allocation happens on the hot path. Elements are [`Fp254`] values,
+/// zero-initialized.
+pub struct TraceBuffer {
+    arena: Vec<AlignedBlock>,
+    rows: usize,
+    cols: usize,
+}
+
+impl TraceBuffer {
+    /// Allocate a zeroed trace sized from `shape` in one arena allocation.
+    pub fn from_shape(shape: &TraceShape) -> Self {
+        let rows = shape.rows as usize;
+        let cols = shape.total_cols() as usize;
+        let bytes = rows * cols * std::mem::size_of::<Fp254>();
+        let blocks = bytes.div_ceil(std::mem::size_of::<AlignedBlock>());
+        Self {
+            arena: vec![AlignedBlock([0u8; 64]); blocks],
+            rows,
+            cols,
+        }
+    }
+
+    /// Rows per column.
+    pub fn rows(&self) -> usize {
+        self.rows
+    }
+
+    /// Bytes held by the arena.
+    pub fn byte_len(&self) -> usize {
+        self.arena.len() * std::mem::size_of::<AlignedBlock>()
+    }
+
+    /// Total columns (main + constant + periodic).
+    pub fn cols(&self) -> usize {
+        self.cols
+    }
+
+    fn elements(&self) -> &[Fp254] {
+        // SAFETY: the arena is a live allocation of at least rows*cols
+        // elements, 64-byte aligned (above Fp254's alignment), and the
+        // all-zero bit pattern is a valid Fp254 (the field's zero).
+        unsafe {
+            std::slice::from_raw_parts(self.arena.as_ptr() as *const Fp254, self.rows * self.cols)
+        }
+    }
+
+    fn elements_mut(&mut self) -> &mut [Fp254] {
+        // SAFETY: as in `elements`, plus the mutable borrow of `self` makes
+        // the view exclusive.
+        unsafe {
+            std::slice::from_raw_parts_mut(
+                self.arena.as_mut_ptr() as *mut Fp254,
+                self.rows * self.cols,
+            )
+        }
+    }
+
+    /// Contiguous read view of one column.
+    pub fn column(&self, col: usize) -> &[Fp254] {
+        assert!(col < self.cols, "column {col} out of range");
+        &self.elements()[col * self.rows..(col + 1) * self.rows]
+    }
+
+    /// Contiguous write view of one column.
+    pub fn column_mut(&mut self, col: usize) -> &mut [Fp254] {
+        assert!(col < self.cols, "column {col} out of range");
+        let rows = self.rows;
+        &mut self.elements_mut()[col * rows..(col + 1) * rows]
+    }
+
+    /// Fill the whole trace from `f(col, row)`, one worker per column chunk.
+    ///
+    /// Workers receive whole columns so every write stays contiguous; traces
+    /// below [`FILL_PARALLEL_THRESHOLD`] rows fill serially.
+    pub fn fill_parallel<F>(&mut self, f: F)
+    where
+        F: Fn(usize, usize) -> Fp254 + Sync,
+    {
+        let rows = self.rows;
+        let cols = self.cols;
+        if rows == 0 || cols == 0 {
+            return;
+        }
+        let total = rows * cols;
+        // wasm targets have no threads; everything fills serially there.
+        if rows < FILL_PARALLEL_THRESHOLD || cfg!(target_family = "wasm") {
+            for (col, out) in self.elements_mut()[..total].chunks_mut(rows).enumerate() {
+                for (row, slot) in out.iter_mut().enumerate() {
+                    *slot = f(col, row);
+                }
+            }
+            return;
+        }
+        let cores = std::thread::available_parallelism()
+            .map(|n| n.get())
+            .unwrap_or(1);
+        let cols_per_worker = cols.div_ceil(cores.min(cols));
+        let f = &f;
+        std::thread::scope(|scope| {
+            for (chunk_idx, out) in self.elements_mut()[..total]
+                .chunks_mut(rows * cols_per_worker)
+                .enumerate()
+            {
+                let first_col = chunk_idx * cols_per_worker;
+                scope.spawn(move || {
+                    for (offset, column) in out.chunks_mut(rows).enumerate() {
+                        let col = first_col + offset;
+                        for (row, slot) in column.iter_mut().enumerate() {
+                            *slot = f(col, row);
+                        }
+                    }
+                });
+            }
+        });
+    }
+
+    /// Reset every element to zero without touching the allocation.
+    fn zero(&mut self) {
+        for block in self.arena.iter_mut() {
+            block.0 = [0u8; 64];
+        }
+    }
+}
+
+/// Reusable pool of [`TraceBuffer`] arenas with peak-memory accounting.
+///
+/// Checking out a buffer reuses a pooled arena of the same shape (re-zeroed)
+/// when one is free, so repeated proofs of the same AIR allocate once instead
+/// of once per proof. The pool tracks the high-water mark of bytes it owns —
+/// live plus idle — which is what gets compared against a profile's
+/// `max_memory_mib` budget.
+#[derive(Default)]
+pub struct TracePool {
+    free: Vec<TraceBuffer>,
+    live_bytes: usize,
+    peak_bytes: usize,
+}
+
+impl TracePool {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Take a zeroed buffer for `shape`, reusing a pooled arena when one
+    /// matches the shape exactly.
+    pub fn checkout(&mut self, shape: &TraceShape) -> TraceBuffer {
+        let rows = shape.rows as usize;
+        let cols = shape.total_cols() as usize;
+        let buf = match self
+            .free
+            .iter()
+            .position(|b| b.rows == rows && b.cols == cols)
+        {
+            Some(idx) => {
+                let mut buf = self.free.swap_remove(idx);
+                buf.zero();
+                buf
+            }
+            None => TraceBuffer::from_shape(shape),
+        };
+        self.live_bytes += buf.byte_len();
+        self.peak_bytes = self.peak_bytes.max(self.live_bytes + self.idle_bytes());
+        buf
+    }
+
+    /// Return a buffer to the pool for reuse.
+    pub fn recycle(&mut self, buf: TraceBuffer) {
+        self.live_bytes = self.live_bytes.saturating_sub(buf.byte_len());
+        self.free.push(buf);
+    }
+
+    /// Drop idle arenas, keeping live checkouts in the accounting.
+    pub fn shrink(&mut self) {
+        self.free.clear();
+    }
+
+    fn idle_bytes(&self) -> usize {
+        self.free.iter().map(|b| b.byte_len()).sum()
+    }
+
+    /// High-water mark of bytes owned by the pool (live + idle).
+    pub fn peak_bytes(&self) -> usize {
+        self.peak_bytes
+    }
 }
@@ -65,6 +65,13 @@ pub fn validate_air_against_backend(
     let caps = get_caps(backend_id)
         .map_err(|_| CapabilityError::Mismatch(format!("unknown backend '{}'", backend_id)))?;
 
+    if air.meta.range_mode == Some(crate::air::AirRangeMode::Lookup) && !caps.lookups {
+        return Err(CapabilityError::Mismatch(format!(
+            "program selects lookup range checks but backend '{}' does not support lookups",
+            backend_id
+        )));
+    }
+
     if let Some(req) = &air.commitments {
         if req.pedersen && !caps.pedersen {
             return Err(CapabilityError::Mismatch(format!(
@@ -141,6 +141,8 @@ pub enum ValidationErrorCode {
     KeccakNotEnabled,
     PedersenNotEnabled,
     CurveNotAllowed,
+    StructureInvalid,
+    BackendMismatch,
 }
 
 #[derive(Debug, Clone, Serialize, Deserialize)]
@@ -493,6 +495,240 @@ impl<'a> Validator<'a> {
     }
 }
 
+// --- Sectioned, incremental AIR validation -------------------------------
+//
+// CI gates that validate many AIRs run the independent checks below as
+// sections: each section's result is keyed by a content hash of exactly the
+// AIR fragment it inspects, cached results are reused when the fragment is
+// unchanged, and sections that do need rechecking run concurrently on
+// scoped threads.
+
+/// Result of one validation section, cacheable across runs.
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct SectionResult {
+    pub section: String,
+    /// Hex BLAKE3 of the AIR fragment this section inspected.
+    pub input_hash: String,
+    pub errors: Vec<ValidationError>,
+    pub warnings: Vec<ValidationWarning>,
+    pub time_ms: u64,
+}
+
+impl SectionResult {
+    pub fn ok(&self) -> bool {
+        self.errors.is_empty()
+    }
+}
+
+/// Persistent section-result cache, one per report directory.
+#[derive(Debug, Default, Serialize, Deserialize)]
+pub struct ReportCache {
+    entries: BTreeMap<String, SectionResult>,
+}
+
+impl ReportCache {
+    /// Load a cache file; a missing or unreadable file yields an empty cache
+    /// so incremental validation degrades to a full run.
+    pub fn load<P: AsRef<std::path::Path>>(path: P) -> Self {
+        std::fs::read_to_string(path)
+            .ok()
+            .and_then(|s| serde_json::from_str(&s).ok())
+            .unwrap_or_default()
+    }
+
+    pub fn save<P: AsRef<std::path::Path>>(&self, path: P) -> std::io::Result<()> {
+        if let Some(dir) = path.as_ref().parent() {
+            if !dir.as_os_str().is_empty() {
+                std::fs::create_dir_all(dir)?;
+            }
+        }
+        std::fs::write(
+            path,
+            serde_json::to_string_pretty(self).expect("cache serializes"),
+        )
+    }
+
+    pub fn len(&self) -> usize {
+        self.entries.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.entries.is_empty()
+    }
+
+    fn lookup(&self, section: &str, input_hash: &str) -> Option<&SectionResult> {
+        self.entries
+            .get(section)
+            .filter(|r| r.input_hash == input_hash)
+    }
+
+    fn store(&mut self, result: SectionResult) {
+        self.entries.insert(result.section.clone(), result);
+    }
+}
+
+/// Outcome of one incremental validation pass.
+#[derive(Debug)]
+pub struct IncrementalOutcome {
+    pub sections: Vec<SectionResult>,
+    /// How many sections were satisfied from the cache without rechecking.
+    pub reused: usize,
+}
+
+impl IncrementalOutcome {
+    pub fn ok(&self) -> bool {
+        self.sections.iter().all(|s| s.ok())
+    }
+}
+
+/// Hex BLAKE3 of one section's input fragment.
+fn fragment_hash(section: &str, fragment: &serde_json::Value) -> String {
+    let bytes = serde_json::to_vec(fragment).expect("fragment serializes");
+    let digest = crate::crypto::registry::HashId::Blake3
+        .hash_many("VALIDATE/SECTION", &[section.as_bytes(), &bytes]);
+    let mut hex = String::with_capacity(64);
+    for b in digest {
+        hex.push_str(&format!("{b:02x}"));
+    }
+    hex
+}
+
+fn structure_section(air: &crate::air::AirProgram) -> (Vec<ValidationError>, Vec<ValidationWarning>) {
+    match air.validate() {
+        Ok(()) => (Vec::new(), Vec::new()),
+        Err(err) => (
+            vec![ValidationError::new(
+                ValidationErrorCode::StructureInvalid,
+                err.to_string(),
+                serde_json::json!({"section": "structure"}),
+            )],
+            Vec::new(),
+        ),
+    }
+}
+
+fn backend_caps_section(
+    air: &crate::air::AirProgram,
+    backend_id: &str,
+) -> (Vec<ValidationError>, Vec<ValidationWarning>) {
+    match crate::validate::validate_air_against_backend(air, backend_id) {
+        Ok(()) => (Vec::new(), Vec::new()),
+        Err(err) => (
+            vec![ValidationError::new(
+                ValidationErrorCode::BackendMismatch,
+                err.to_string(),
+                serde_json::json!({"section": "backend_caps", "backend": backend_id}),
+            )],
+            Vec::new(),
+        ),
+    }
+}
+
+fn commitments_section(
+    air: &crate::air::AirProgram,
+) -> (Vec<ValidationError>, Vec<ValidationWarning>) {
+    let bindings = crate::air::bindings::Bindings::from_air(air);
+    let report = Validator::new(&bindings).finalize();
+    (report.errors, report.warnings)
+}
+
+/// Validate `air` against `backend_id` in independent sections, reusing
+/// cached results for sections whose input fragment is unchanged and running
+/// the rest concurrently. The cache is updated in place; persist it with
+/// [`ReportCache::save`].
+pub fn validate_air_incremental(
+    air: &crate::air::AirProgram,
+    backend_id: &str,
+    cache: &mut ReportCache,
+) -> IncrementalOutcome {
+    let air_value = serde_json::to_value(air).expect("AIR serializes");
+    let caps_fragment = serde_json::json!({
+        "meta": air.meta,
+        "columns": air.columns,
+        "backend": backend_id,
+    });
+    let commit_fragment = serde_json::json!({
+        "commitments": air.commitments,
+        "hash": air.meta.hash,
+    });
+
+    type SectionFn<'s> = Box<dyn Fn() -> (Vec<ValidationError>, Vec<ValidationWarning>) + Send + 's>;
+    let sections: Vec<(&str, String, SectionFn)> = vec![
+        (
+            "structure",
+            fragment_hash("structure", &air_value),
+            Box::new(|| structure_section(air)),
+        ),
+        (
+            "backend_caps",
+            fragment_hash("backend_caps", &caps_fragment),
+            Box::new(move || backend_caps_section(air, backend_id)),
+        ),
+        (
+            "commitments",
+            fragment_hash("commitments", &commit_fragment),
+            Box::new(|| commitments_section(air)),
+        ),
+    ];
+
+    let mut reused = 0usize;
+    let mut cached_results = Vec::new();
+    let mut pending: Vec<(&str, String, SectionFn)> = Vec::new();
+    for (name, input_hash, run) in sections {
+        if let Some(hit) = cache.lookup(name, &input_hash) {
+            cached_results.push(hit.clone());
+            reused += 1;
+        } else {
+            pending.push((name, input_hash, run));
+        }
+    }
+
+    // Recheck the stale sections concurrently; each slot is owned by exactly
+    // one thread so results stay in declaration order. wasm targets have no
+    // threads, so they recheck serially.
+    let mut fresh: Vec<Option<SectionResult>> = (0..pending.len()).map(|_| None).collect();
+    if cfg!(target_family = "wasm") {
+        for ((name, input_hash, run), slot) in pending.into_iter().zip(fresh.iter_mut()) {
+            let clock = Instant::now();
+            let (errors, warnings) = run();
+            *slot = Some(SectionResult {
+                section: name.to_string(),
+                input_hash,
+                errors,
+                warnings,
+                time_ms: clock.elapsed().as_millis() as u64,
+            });
+        }
+    } else {
+        std::thread::scope(|scope| {
+            for ((name, input_hash, run), slot) in pending.into_iter().zip(fresh.iter_mut()) {
+                scope.spawn(move || {
+                    let clock = Instant::now();
+                    let (errors, warnings) = run();
+                    *slot = Some(SectionResult {
+                        section: name.to_string(),
+                        input_hash,
+                        errors,
+                        warnings,
+                        time_ms: clock.elapsed().as_millis() as u64,
+                    });
+                });
+            }
+        });
+    }
+
+    let mut results = cached_results;
+    for result in fresh.into_iter().flatten() {
+        cache.store(result.clone());
+        results.push(result);
+    }
+    results.sort_by(|a, b| a.section.cmp(&b.section));
+    IncrementalOutcome {
+        sections: results,
+        reused,
+    }
+}
+
 /// Utility to assert that all backend digests within a registry entry match exactly.
 pub fn assert_digest_parity(digests: &BTreeMap<String, String>) -> Result<()> {
     if digests.is_empty() {
@@ -700,6 +936,90 @@ mod tests {
             .all(|c| matches!(c, 'A'..='Z' | 'a'..='z' | '0'..='9' | '.' | '_' | '-')));
     }
 
+    fn toy_air(trace_cols: u32) -> crate::air::AirProgram {
+        toml::from_str(&format!(
+            r#"rows_hint = 64
+
+[meta]
+name = "validation_toy"
+field = "Prime254"
+hash = "blake3"
+
+[columns]
+trace_cols = {trace_cols}
+const_cols = 1
+periodic_cols = 0
+
+[constraints]
+transition_count = 2
+boundary_count = 1
+"#
+        ))
+        .unwrap()
+    }
+
+    #[test]
+    fn incremental_validation_reuses_unchanged_sections() {
+        crate::registry::ensure_builtins_registered();
+        let air = toy_air(4);
+        let mut cache = ReportCache::default();
+
+        let first = validate_air_incremental(&air, "native@0.0", &mut cache);
+        assert!(first.ok());
+        assert_eq!(first.reused, 0);
+        assert_eq!(first.sections.len(), 3);
+
+        let second = validate_air_incremental(&air, "native@0.0", &mut cache);
+        assert!(second.ok());
+        assert_eq!(second.reused, 3, "unchanged AIR must be fully cached");
+
+        // Touching the columns invalidates the sections that inspect them
+        // (structure hashes the whole AIR, backend_caps hashes meta+columns)
+        // but leaves the commitments section cached.
+        let changed = toy_air(5);
+        let third = validate_air_incremental(&changed, "native@0.0", &mut cache);
+        assert!(third.ok());
+        assert_eq!(third.reused, 1);
+    }
+
+    #[test]
+    fn report_cache_persists_across_loads() {
+        crate::registry::ensure_builtins_registered();
+        let air = toy_air(4);
+        let temp = tempdir().unwrap();
+        let cache_path = temp.path().join("validation_cache.json");
+
+        let mut cache = ReportCache::load(&cache_path);
+        assert!(cache.is_empty());
+        validate_air_incremental(&air, "native@0.0", &mut cache);
+        cache.save(&cache_path).unwrap();
+
+        let mut reloaded = ReportCache::load(&cache_path);
+        assert_eq!(reloaded.len(), 3);
+        let rerun = validate_air_incremental(&air, "native@0.0", &mut reloaded);
+        assert_eq!(rerun.reused, 3);
+    }
+
+    #[test]
+    fn unknown_backend_fails_backend_section_only() {
+        crate::registry::ensure_builtins_registered();
+        let air = toy_air(4);
+        let mut cache = ReportCache::default();
+        let outcome = validate_air_incremental(&air, "missing@9.9", &mut cache);
+        assert!(!outcome.ok());
+        let failing: Vec<_> = outcome
+            .sections
+            .iter()
+            .filter(|s| !s.ok())
+            .map(|s| s.section.as_str())
+            .collect();
+        assert_eq!(failing, ["backend_caps"]);
+        assert_eq!(
+            outcome.sections[0].errors.first().map(|e| e.code.clone()),
+            Some(ValidationErrorCode::BackendMismatch)
+        );
+    }
+
     #[test]
     fn serde_roundtrip() {
         let meta = ReportMeta {
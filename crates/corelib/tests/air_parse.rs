@@ -14,3 +14,25 @@ fn parse_and_validate_air() {
     let inline: AirProgram = toml::from_str(TOY_AIR_SRC).unwrap();
     assert_eq!(inline.rows_hint, Some(65536));
 }
+
+#[test]
+fn range_mode_parses_and_selects_gadget() {
+    use zkprov_corelib::air::AirRangeMode;
+    use zkprov_corelib::gadgets::range::{RangeCheckMode, DEFAULT_LOOKUP_TABLE_BITS};
+
+    // Default (absent) selects bit decomposition.
+    let air = AirProgram::load_from_file(TOY_AIR).expect("load");
+    assert_eq!(air.meta.range_mode, None);
+    assert_eq!(air.range_check_mode(), RangeCheckMode::BitDecomposition);
+
+    // Explicit lookup selection maps to the default limb table.
+    let src = TOY_AIR_SRC.replace("[meta]", "[meta]\nrange_mode = \"lookup\"");
+    let air: AirProgram = toml::from_str(&src).unwrap();
+    assert_eq!(air.meta.range_mode, Some(AirRangeMode::Lookup));
+    assert_eq!(
+        air.range_check_mode(),
+        RangeCheckMode::Lookup {
+            table_bits: DEFAULT_LOOKUP_TABLE_BITS
+        }
+    );
+}
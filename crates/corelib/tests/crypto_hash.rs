@@ -45,3 +45,13 @@ mod hex {
         }
     }
 }
+
+#[test]
+fn hash_many_equals_concatenation() {
+    use zkprov_corelib::crypto::blake3::Blake3;
+    use zkprov_corelib::crypto::hash::{hash_labeled, hash_many};
+    let parts: &[&[u8]] = &[b"alpha", b"", b"beta", b"gamma"];
+    let concat: Vec<u8> = parts.concat();
+    assert_eq!(hash_many::<Blake3>("LBL", parts), hash_labeled::<Blake3>("LBL", &concat));
+    assert_eq!(hash_many::<Blake3>("LBL", &[]), hash_labeled::<Blake3>("LBL", b""));
+}
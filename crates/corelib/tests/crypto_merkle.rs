@@ -38,3 +38,77 @@ fn inclusion_proof_roundtrip_arity2() {
         assert!(verify_arity2::<Blake3>(&ls[i], i, &prf, &root));
     }
 }
+
+#[test]
+fn flat_tree_matches_vec_api_for_all_sizes() {
+    for n in 1..=33 {
+        let ls = leaves(n);
+        let refs: Vec<&[u8]> = ls.iter().map(|l| l.as_slice()).collect();
+        let tree = MerkleTree2::build::<Blake3>(&refs);
+        assert_eq!(tree.leaf_count(), n);
+        assert_eq!(tree.root(), root_arity2::<Blake3>(&ls));
+        assert_eq!(root_arity2_slices::<Blake3>(&refs), tree.root());
+    }
+}
+
+#[test]
+fn flat_tree_proofs_match_and_verify() {
+    let ls = leaves(11);
+    let refs: Vec<&[u8]> = ls.iter().map(|l| l.as_slice()).collect();
+    let tree = MerkleTree2::build::<Blake3>(&refs);
+    let root = tree.root();
+    for i in 0..ls.len() {
+        let prf = tree.proof(i);
+        assert_eq!(prf.path, prove_arity2::<Blake3>(&ls, i).path);
+        assert!(verify_arity2::<Blake3>(&ls[i], i, &prf, &root));
+    }
+}
+
+#[test]
+fn accumulator_matches_batch_root_for_all_sizes() {
+    let ls = leaves(64);
+    let mut acc = MerkleAccumulator2::<Blake3>::new();
+    assert!(acc.is_empty());
+    assert_eq!(acc.root(), None);
+    for n in 1..=64 {
+        acc.append(&ls[n - 1]);
+        assert_eq!(acc.len(), n as u64);
+        assert_eq!(acc.root(), Some(root_arity2::<Blake3>(&ls[..n])));
+    }
+}
+
+#[test]
+fn accumulator_snapshot_restore_continues_stream() {
+    let ls = leaves(23);
+    let mut acc = MerkleAccumulator2::<Blake3>::new();
+    for leaf in &ls[..11] {
+        acc.append(leaf);
+    }
+
+    let snapshot = acc.snapshot();
+    let mut restored = MerkleAccumulator2::<Blake3>::restore(&snapshot).unwrap();
+    assert_eq!(restored.len(), 11);
+    assert_eq!(restored.root(), acc.root());
+
+    for leaf in &ls[11..] {
+        acc.append(leaf);
+        restored.append(leaf);
+    }
+    assert_eq!(restored.root(), acc.root());
+    assert_eq!(restored.root(), Some(root_arity2::<Blake3>(&ls)));
+
+    // Truncated or mismatched snapshots are rejected.
+    assert!(MerkleAccumulator2::<Blake3>::restore(&snapshot[..snapshot.len() - 1]).is_none());
+    assert!(MerkleAccumulator2::<Blake3>::restore(&[0u8; 4]).is_none());
+}
+
+#[test]
+fn flat_tree_parallel_path_matches_serial() {
+    // Enough leaves to cross the parallel threshold inside the builder.
+    let ls = leaves(5000);
+    let refs: Vec<&[u8]> = ls.iter().map(|l| l.as_slice()).collect();
+    let tree = MerkleTree2::build::<Blake3>(&refs);
+    assert_eq!(tree.root(), root_arity2::<Blake3>(&ls));
+    let prf = tree.proof(4999);
+    assert!(verify_arity2::<Blake3>(&ls[4999], 4999, &prf, &tree.root()));
+}
@@ -1,5 +1,6 @@
 use zkprov_corelib::evm::abi::{
-    decode_body, decode_meta, decode_public_io, encode_body, encode_meta, encode_public_io,
+    decode_batch, decode_body, decode_meta, decode_public_io, encode_batch, encode_body,
+    encode_meta, encode_public_io,
 };
 use zkprov_corelib::evm::digest::keccak256_bytes;
 use zkprov_corelib::proof::ProofHeader;
@@ -44,6 +45,59 @@ fn abi_round_trip_meta_and_body() {
     assert_eq!(decoded_io, json);
 }
 
+fn batch_header(pubio_hash: u64, body_len: u64) -> ProofHeader {
+    ProofHeader {
+        backend_id_hash: 42,
+        profile_id_hash: 7,
+        pubio_hash,
+        body_len,
+    }
+}
+
+#[test]
+fn batch_round_trip_dedupes_shared_prefix() {
+    // Rollup-style batch: the public IO is identical except for a trailing
+    // nonce, so the shared prefix carries nearly all of the bytes.
+    let shared = format!(r#"{{"chain_id":31337,"state_root":"{}","nonce":"#, "ab".repeat(32));
+    let ios: Vec<String> = (0..8).map(|n| format!("{shared}{n}}}")).collect();
+    let proofs: Vec<(ProofHeader, &str, &[u8])> = ios
+        .iter()
+        .enumerate()
+        .map(|(n, io)| (batch_header(n as u64, 8), io.as_str(), b"bodybody".as_slice()))
+        .collect();
+
+    let blob = encode_batch(&proofs).expect("batch encode");
+    let decoded = decode_batch(&blob).expect("batch decode");
+    assert_eq!(decoded.len(), 8);
+    for ((header, io, body), (d_header, d_io, d_body)) in proofs.iter().zip(&decoded) {
+        assert_eq!(header, d_header);
+        assert_eq!(io, d_io);
+        assert_eq!(*body, d_body.as_slice());
+    }
+
+    // Packing N proofs amortizes the shared header and IO prefix: the blob
+    // must beat N separately-encoded (meta, io, body) triples.
+    let separate: usize = proofs
+        .iter()
+        .map(|(h, io, body)| encode_meta(h).len() + encode_public_io(io).len() + encode_body(body).len())
+        .sum();
+    assert!(blob.len() < separate, "batch {} >= separate {}", blob.len(), separate);
+}
+
+#[test]
+fn batch_rejects_mixed_profiles_and_empty() {
+    assert!(encode_batch(&[]).is_err());
+
+    let mut other = batch_header(9, 1);
+    other.profile_id_hash = 8;
+    let mixed: Vec<(ProofHeader, &str, &[u8])> =
+        vec![(batch_header(1, 1), "{}", b"x"), (other, "{}", b"y")];
+    assert!(encode_batch(&mixed).is_err());
+
+    let bad_len: Vec<(ProofHeader, &str, &[u8])> = vec![(batch_header(1, 3), "{}", b"x")];
+    assert!(encode_batch(&bad_len).is_err());
+}
+
 mod hex {
     pub fn decode(s: &str) -> Result<Vec<u8>, String> {
         if !s.len().is_multiple_of(2) {
@@ -1,4 +1,7 @@
-use zkprov_corelib::gadgets::range::{range_check_slice_u64, range_check_u64};
+use zkprov_corelib::gadgets::range::{
+    range_check_slice_u64, range_check_slice_u64_with, range_check_u64, LookupRangeTable,
+    RangeCheckMode, DEFAULT_LOOKUP_TABLE_BITS,
+};
 
 #[test]
 fn range_ok_and_fail() {
@@ -15,3 +18,45 @@ fn range_batch() {
     let ys = [0, 8];
     assert!(range_check_slice_u64(&ys, 3).is_err());
 }
+
+#[test]
+fn lookup_mode_matches_bit_decomposition_verdicts() {
+    let mode = RangeCheckMode::Lookup {
+        table_bits: DEFAULT_LOOKUP_TABLE_BITS,
+    };
+    let cases: &[(&[u64], u32, bool)] = &[
+        (&[0, 1, 2, 3, 7], 3, true),
+        (&[0, 8], 3, false),
+        (&[u64::MAX], 64, true),
+        (&[u64::MAX], 63, false),
+        (&[15, 16], 4, false),
+    ];
+    for &(xs, k, ok) in cases {
+        let bits = range_check_slice_u64_with(xs, k, RangeCheckMode::BitDecomposition).is_ok();
+        let lookup = range_check_slice_u64_with(xs, k, mode).is_ok();
+        assert_eq!(bits, ok, "bits verdict for {xs:?} k={k}");
+        assert_eq!(lookup, ok, "lookup verdict for {xs:?} k={k}");
+    }
+}
+
+#[test]
+fn lookup_table_records_multiplicities() {
+    let mut table = LookupRangeTable::new(8).unwrap();
+    // One 64-bit check = 8 probes instead of 64 bit constraints.
+    assert_eq!(table.probes_per_value(64), 8);
+    assert_eq!(RangeCheckMode::BitDecomposition.cost_per_value(64), 64);
+    assert_eq!(
+        RangeCheckMode::Lookup { table_bits: 8 }.cost_per_value(64),
+        8
+    );
+
+    table.check(0x0102_0304_0506_0708, 64).unwrap();
+    assert_eq!(table.total_probes(), 8);
+    for limb in 1u64..=8 {
+        assert_eq!(table.multiplicities()[limb as usize], 1, "limb {limb}");
+    }
+
+    assert!(LookupRangeTable::new(0).is_err());
+    assert!(LookupRangeTable::new(17).is_err());
+    assert!(table.check(1, 0).is_err());
+}
@@ -19,6 +19,48 @@ fn validation_enforces_bounds() {
         merkle_arity: Some(7),
         const_col_limit: None,
         rows_max: None,
+        max_threads: Some(0),
+        max_memory_mib: Some(0),
     };
     assert!(bad.validate().is_err());
 }
+
+#[test]
+fn effective_threads_honors_cap() {
+    let mut p = Profile {
+        id: "capped".to_string(),
+        lambda_bits: 80,
+        fri_blowup: None,
+        fri_queries: None,
+        grind_bits: None,
+        merkle_arity: None,
+        const_col_limit: None,
+        rows_max: None,
+        max_threads: Some(1),
+        max_memory_mib: None,
+    };
+    assert!(p.validate().is_ok());
+    assert_eq!(p.effective_threads(), 1);
+    p.max_threads = None;
+    assert!(p.effective_threads() >= 1);
+}
+
+#[test]
+fn memory_budget_converts_to_bytes() {
+    let mut p = Profile {
+        id: "tiny".to_string(),
+        lambda_bits: 80,
+        fri_blowup: None,
+        fri_queries: None,
+        grind_bits: None,
+        merkle_arity: None,
+        const_col_limit: None,
+        rows_max: None,
+        max_threads: None,
+        max_memory_mib: Some(64),
+    };
+    assert!(p.validate().is_ok());
+    assert_eq!(p.memory_budget_bytes(), Some(64 * 1024 * 1024));
+    p.max_memory_mib = None;
+    assert_eq!(p.memory_budget_bytes(), None);
+}
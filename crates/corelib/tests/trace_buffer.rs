@@ -0,0 +1,101 @@
+use zkprov_corelib::crypto::fp254::Fp254;
+use zkprov_corelib::trace::{TraceBuffer, TracePool, TraceShape};
+
+fn shape(rows: u32, cols: u32, const_cols: u32, periodic_cols: u32) -> TraceShape {
+    TraceShape {
+        rows,
+        cols,
+        const_cols,
+        periodic_cols,
+    }
+}
+
+#[test]
+fn buffer_is_zeroed_and_aligned() {
+    let buf = TraceBuffer::from_shape(&shape(64, 3, 1, 1));
+    assert_eq!(buf.rows(), 64);
+    assert_eq!(buf.cols(), 5);
+    for col in 0..buf.cols() {
+        let view = buf.column(col);
+        assert_eq!(view.len(), 64);
+        assert!(view.iter().all(|v| *v == Fp254::zero()));
+    }
+    assert_eq!(buf.column(0).as_ptr() as usize % 64, 0);
+}
+
+#[test]
+fn column_views_are_independent() {
+    let mut buf = TraceBuffer::from_shape(&shape(8, 2, 0, 0));
+    for (row, slot) in buf.column_mut(1).iter_mut().enumerate() {
+        *slot = Fp254::from_u64(row as u64 + 1);
+    }
+    assert!(buf.column(0).iter().all(|v| *v == Fp254::zero()));
+    assert_eq!(buf.column(1)[3], Fp254::from_u64(4));
+}
+
+#[test]
+fn parallel_fill_matches_serial_fill() {
+    // Above the parallel threshold so the scoped-thread path runs.
+    let mut par = TraceBuffer::from_shape(&shape(2048, 4, 0, 0));
+    par.fill_parallel(|col, row| Fp254::from_u64((col as u64) << 32 | row as u64));
+
+    // Below the threshold the same closure fills serially.
+    let mut serial = TraceBuffer::from_shape(&shape(16, 4, 0, 0));
+    serial.fill_parallel(|col, row| Fp254::from_u64((col as u64) << 32 | row as u64));
+
+    for col in 0..4 {
+        for row in 0..16 {
+            assert_eq!(par.column(col)[row], serial.column(col)[row]);
+        }
+        assert_eq!(
+            par.column(col)[2047],
+            Fp254::from_u64((col as u64) << 32 | 2047)
+        );
+    }
+}
+
+#[test]
+#[should_panic(expected = "out of range")]
+fn out_of_range_column_panics() {
+    let buf = TraceBuffer::from_shape(&shape(4, 1, 0, 0));
+    let _ = buf.column(1);
+}
+
+#[test]
+fn projected_bytes_matches_allocation() {
+    let s = shape(1 << 10, 3, 1, 0);
+    let buf = TraceBuffer::from_shape(&s);
+    // The arena rounds up to whole 64-byte blocks, never by more than one.
+    assert!(buf.byte_len() as u64 >= s.projected_bytes());
+    assert!(buf.byte_len() as u64 - s.projected_bytes() < 64);
+    // u64 projection survives shapes that would overflow usize arithmetic
+    // on 32-bit targets.
+    let huge = shape(u32::MAX, 1 << 10, 0, 0);
+    assert!(huge.projected_bytes() > u32::MAX as u64);
+}
+
+#[test]
+fn pool_reuses_arenas_and_tracks_peak() {
+    let s = shape(256, 2, 0, 0);
+    let mut pool = TracePool::new();
+
+    let mut a = pool.checkout(&s);
+    let one_buf = a.byte_len();
+    assert_eq!(pool.peak_bytes(), one_buf);
+
+    a.column_mut(0)[0] = Fp254::from_u64(7);
+    pool.recycle(a);
+
+    // Same shape comes back from the pool, re-zeroed, with no new peak.
+    let b = pool.checkout(&s);
+    assert!(b.column(0).iter().all(|v| *v == Fp254::zero()));
+    assert_eq!(pool.peak_bytes(), one_buf);
+
+    // A second concurrent checkout allocates and raises the high-water mark.
+    let c = pool.checkout(&s);
+    assert_eq!(pool.peak_bytes(), 2 * one_buf);
+    pool.recycle(b);
+    pool.recycle(c);
+    pool.shrink();
+    assert_eq!(pool.peak_bytes(), 2 * one_buf);
+}
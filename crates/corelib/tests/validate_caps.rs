@@ -34,11 +34,10 @@ fn invalid_arity() {
 }
 
 #[test]
-fn recursion_unavailable() {
+fn recursion_available_on_native() {
     ensure_builtins_registered();
     let cfg = Config::new("native@0.0", "Prime254", "blake3", 2, true, "balanced");
-    let err = validate_config(&cfg).unwrap_err().to_string();
-    assert!(err.contains("recursion required"));
+    assert!(validate_config(&cfg).is_ok());
 }
 
 #[test]
@@ -2,21 +2,34 @@ use std::collections::HashMap;
 use std::ffi::{c_char, c_void, CStr};
 use std::ptr;
 use std::slice;
-use std::sync::{Mutex, OnceLock};
+use std::sync::atomic::{AtomicBool, AtomicI32, AtomicU64, AtomicUsize, Ordering};
+use std::sync::{Arc, Mutex, OnceLock};
+use std::time::Instant;
 
 use anyhow::Error as AnyhowError;
 use serde::Serialize;
-use zkprov_backend_native::{native_prove, native_verify};
+use zkprov_backend_native::aggregate::native_aggregate;
+use zkprov_backend_native::{
+    native_prove_prepared, native_prove_prepared_timed, native_verify_prepared, StageTimings,
+};
+use zkprov_bundles::pedersen::{BlindingTracker, PedersenCtx};
+use zkprov_corelib::air::{compiled, AirProgram};
+use zkprov_corelib::air_bindings::{Bindings, CommitmentsPolicy};
 use zkprov_corelib::backend::BackendInfo;
 use zkprov_corelib::config::Config;
+use zkprov_corelib::crypto::registry::hash64_by_id;
 use zkprov_corelib::errors::{CapabilityError, RegistryError};
 use zkprov_corelib::evm::digest::digest_D;
 use zkprov_corelib::profile::load_all_profiles;
 use zkprov_corelib::proof::ProofHeader;
-use zkprov_corelib::{registry, validate::validate_config};
+use zkprov_corelib::{
+    registry,
+    validate::{validate_air_against_backend, validate_config},
+};
 
 mod error;
 mod ffi_json;
+mod pool;
 
 pub use error::{
     ErrorCode, ZKP_ERR_BACKEND, ZKP_ERR_INTERNAL, ZKP_ERR_INVALID_ARG, ZKP_ERR_PROFILE,
@@ -32,8 +45,266 @@ struct Allocation {
 
 type FfiResult<T> = Result<T, ErrorCode>;
 
+/// State cached behind an opaque session handle: the validated config plus the
+/// parsed AIR program, so repeated proves/verifies skip disk, parse, and
+/// validation.
+struct Session {
+    config: Config,
+    air: Arc<AirProgram>,
+}
+
+/// Job states reported through [`ZkpProgress::state`].
+pub const ZKP_JOB_RUNNING: i32 = 0;
+pub const ZKP_JOB_DONE: i32 = 1;
+pub const ZKP_JOB_CANCELLED: i32 = 2;
+pub const ZKP_JOB_FAILED: i32 = 3;
+
+/// Prove stages reported through [`ZkpProgress::stage`].
+pub const ZKP_STAGE_INIT: i32 = 0;
+pub const ZKP_STAGE_LOAD_AIR: i32 = 1;
+pub const ZKP_STAGE_PROVE: i32 = 2;
+pub const ZKP_STAGE_ENCODE: i32 = 3;
+
+/// Fixed-layout progress snapshot returned by `zkp_prove_poll`. Mirrors
+/// `struct zkp_progress` in `include/zkprov.h`.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default)]
+pub struct ZkpProgress {
+    pub state: i32,
+    pub stage: i32,
+    pub percent: i32,
+    pub error: i32,
+}
+
+/// Layout version of [`ZkpProofMeta`] produced by this library.
+pub const ZKP_META_VERSION: u32 = 1;
+
+/// Fixed-layout binary proof metadata returned by `zkp_prove2` and
+/// `zkp_verify2` as an alternative to the JSON envelope, so hot callers can
+/// read the digest and sizes without a serialize/parse round-trip. Mirrors
+/// `struct zkp_proof_meta` in `include/zkprov.h`.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default)]
+pub struct ZkpProofMeta {
+    /// Layout version; [`ZKP_META_VERSION`] for this library.
+    pub version: u32,
+    /// 1 when written by a successful verify, 0 otherwise.
+    pub verified: i32,
+    /// EVM digest D over the proof header and body.
+    pub digest: [u8; 32],
+    /// Proof length in bytes.
+    pub proof_len: u64,
+    /// BLAKE3-derived 64-bit hash of the backend id string.
+    pub backend_hash: u64,
+    /// BLAKE3-derived 64-bit hash of the profile id string.
+    pub profile_hash: u64,
+    /// Wall-clock time spent inside the call, in microseconds.
+    pub elapsed_micros: u64,
+}
+
+/// Shared state between an async prove worker thread and its poll/cancel
+/// callers. The worker checks `cancel` between stages so abandoned proofs
+/// stop burning a core at the next checkpoint.
+struct ProveJob {
+    cancel: AtomicBool,
+    state: AtomicI32,
+    stage: AtomicI32,
+    percent: AtomicI32,
+    error: AtomicI32,
+    result: Mutex<Option<Vec<u8>>>,
+}
+
+impl ProveJob {
+    fn new() -> Self {
+        Self {
+            cancel: AtomicBool::new(false),
+            state: AtomicI32::new(ZKP_JOB_RUNNING),
+            stage: AtomicI32::new(ZKP_STAGE_INIT),
+            percent: AtomicI32::new(0),
+            error: AtomicI32::new(ZKP_OK),
+            result: Mutex::new(None),
+        }
+    }
+
+    /// Returns false if the job was cancelled; otherwise records the stage
+    /// transition and keeps running.
+    fn enter_stage(&self, stage: i32, percent: i32) -> bool {
+        if self.cancel.load(Ordering::Acquire) {
+            self.state.store(ZKP_JOB_CANCELLED, Ordering::Release);
+            return false;
+        }
+        self.stage.store(stage, Ordering::Relaxed);
+        self.percent.store(percent, Ordering::Relaxed);
+        true
+    }
+
+    fn finish(&self, result: FfiResult<Vec<u8>>) {
+        match result {
+            Ok(proof) => {
+                if let Ok(mut slot) = self.result.lock() {
+                    *slot = Some(proof);
+                }
+                self.percent.store(100, Ordering::Relaxed);
+                self.state.store(ZKP_JOB_DONE, Ordering::Release);
+            }
+            Err(code) => {
+                self.error.store(code.into(), Ordering::Relaxed);
+                self.state.store(ZKP_JOB_FAILED, Ordering::Release);
+            }
+        }
+    }
+
+    fn snapshot(&self) -> ZkpProgress {
+        ZkpProgress {
+            state: self.state.load(Ordering::Acquire),
+            stage: self.stage.load(Ordering::Relaxed),
+            percent: self.percent.load(Ordering::Relaxed),
+            error: self.error.load(Ordering::Relaxed),
+        }
+    }
+}
+
+/// Cache key for a validated AIR program: content hash of the AIR file bytes
+/// plus the backend and profile ids the validation ran against.
+type AirCacheKey = ([u8; 32], String, String);
+
+struct AirCacheEntry {
+    air: Arc<AirProgram>,
+    last_used: u64,
+}
+
+/// Process-wide LRU cache of parsed and backend-validated AIR programs, so a
+/// rotating set of AIR files proved through any handle skips disk re-parse
+/// and re-validation once warm.
+struct AirCache {
+    entries: HashMap<AirCacheKey, AirCacheEntry>,
+    tick: u64,
+}
+
+/// Retained AIR programs; sized for a multi-tenant service rotating through
+/// dozens of AIR files without letting the cache grow unbounded.
+const AIR_CACHE_CAPACITY: usize = 64;
+
 static ALLOCATIONS: OnceLock<Mutex<HashMap<usize, Allocation>>> = OnceLock::new();
 static INIT_RESULT: OnceLock<Result<(), ErrorCode>> = OnceLock::new();
+static SESSIONS: OnceLock<Mutex<HashMap<u64, Arc<Session>>>> = OnceLock::new();
+static NEXT_SESSION_ID: AtomicU64 = AtomicU64::new(1);
+static PROVE_JOBS: OnceLock<Mutex<HashMap<u64, Arc<ProveJob>>>> = OnceLock::new();
+static NEXT_JOB_ID: AtomicU64 = AtomicU64::new(1);
+static AIR_CACHE: OnceLock<Mutex<AirCache>> = OnceLock::new();
+
+fn air_cache() -> &'static Mutex<AirCache> {
+    AIR_CACHE.get_or_init(|| {
+        Mutex::new(AirCache {
+            entries: HashMap::new(),
+            tick: 0,
+        })
+    })
+}
+
+fn air_cache_get(key: &AirCacheKey) -> Option<Arc<AirProgram>> {
+    let mut guard = air_cache().lock().ok()?;
+    guard.tick += 1;
+    let tick = guard.tick;
+    let entry = guard.entries.get_mut(key)?;
+    entry.last_used = tick;
+    Some(Arc::clone(&entry.air))
+}
+
+fn air_cache_insert(key: AirCacheKey, air: Arc<AirProgram>) {
+    let Ok(mut guard) = air_cache().lock() else {
+        return;
+    };
+    guard.tick += 1;
+    let tick = guard.tick;
+    if guard.entries.len() >= AIR_CACHE_CAPACITY && !guard.entries.contains_key(&key) {
+        if let Some(evict) = guard
+            .entries
+            .iter()
+            .min_by_key(|(_, entry)| entry.last_used)
+            .map(|(key, _)| key.clone())
+        {
+            guard.entries.remove(&evict);
+        }
+    }
+    guard
+        .entries
+        .insert(key, AirCacheEntry { air, last_used: tick });
+}
+
+/// Load an AIR program for `config`, consulting the content-addressed cache.
+///
+/// The file bytes are hashed first; on a hit the cached program is returned
+/// with no parse or validation work. On a miss the program is parsed through
+/// the normal [`AirProgram::load_from_file`] dispatch, validated against the
+/// backend, and cached under (content hash, backend id, profile id).
+fn load_air_cached(config: &Config, air_path: &str) -> FfiResult<Arc<AirProgram>> {
+    let bytes = std::fs::read(air_path).map_err(|_| ErrorCode::InvalidArg)?;
+    let digest = zkprov_corelib::crypto::registry::hash32_by_id("blake3", "FFI/AIRCACHE", &bytes)
+        .ok_or(ErrorCode::Internal)?;
+    let key = (
+        digest,
+        config.backend_id.clone(),
+        config.profile_id.clone(),
+    );
+    if let Some(air) = air_cache_get(&key) {
+        return Ok(air);
+    }
+
+    let air = AirProgram::load_from_file(air_path).map_err(|_| ErrorCode::InvalidArg)?;
+    validate_air_against_backend(&air, &config.backend_id).map_err(|e| map_capability_error(&e))?;
+    let air = Arc::new(air);
+    air_cache_insert(key, Arc::clone(&air));
+    Ok(air)
+}
+
+fn prove_jobs() -> &'static Mutex<HashMap<u64, Arc<ProveJob>>> {
+    PROVE_JOBS.get_or_init(|| Mutex::new(HashMap::new()))
+}
+
+fn get_prove_job(id: u64) -> FfiResult<Arc<ProveJob>> {
+    prove_jobs()
+        .lock()
+        .map_err(|_| ErrorCode::Internal)?
+        .get(&id)
+        .cloned()
+        .ok_or(ErrorCode::InvalidArg)
+}
+
+fn remove_prove_job(id: u64) {
+    if let Ok(mut guard) = prove_jobs().lock() {
+        guard.remove(&id);
+    }
+}
+
+fn sessions() -> &'static Mutex<HashMap<u64, Arc<Session>>> {
+    SESSIONS.get_or_init(|| Mutex::new(HashMap::new()))
+}
+
+fn insert_session(session: Session) -> FfiResult<u64> {
+    let id = NEXT_SESSION_ID.fetch_add(1, Ordering::Relaxed);
+    let mut guard = sessions().lock().map_err(|_| ErrorCode::Internal)?;
+    guard.insert(id, Arc::new(session));
+    Ok(id)
+}
+
+fn get_session(id: u64) -> FfiResult<Arc<Session>> {
+    sessions()
+        .lock()
+        .map_err(|_| ErrorCode::Internal)?
+        .get(&id)
+        .cloned()
+        .ok_or(ErrorCode::InvalidArg)
+}
+
+fn remove_session(id: u64) -> FfiResult<()> {
+    sessions()
+        .lock()
+        .map_err(|_| ErrorCode::Internal)?
+        .remove(&id)
+        .map(|_| ())
+        .ok_or(ErrorCode::InvalidArg)
+}
 
 fn allocations() -> &'static Mutex<HashMap<usize, Allocation>> {
     ALLOCATIONS.get_or_init(|| Mutex::new(HashMap::new()))
@@ -57,9 +328,8 @@ fn release_allocation(ptr: *mut u8) {
         return;
     }
     if let Some(alloc) = take_allocation(ptr) {
-        unsafe {
-            Vec::from_raw_parts(ptr, alloc.len, alloc.cap);
-        }
+        let buf = unsafe { Vec::from_raw_parts(ptr, alloc.len, alloc.cap) };
+        pool::release(buf);
     }
 }
 
@@ -67,7 +337,7 @@ fn alloc_bytes(len: usize) -> FfiResult<*mut u8> {
     if len == 0 {
         return Ok(ptr::null_mut());
     }
-    let mut buf = vec![0u8; len];
+    let mut buf = pool::acquire(len);
     let ptr = buf.as_mut_ptr();
     let cap = buf.capacity();
     store_allocation(ptr, len, cap)?;
@@ -84,6 +354,7 @@ fn leak_vec(mut vec: Vec<u8>) -> FfiResult<*mut u8> {
     let ptr = vec.as_mut_ptr();
     store_allocation(ptr, len, cap)?;
     std::mem::forget(vec);
+    pool::track_foreign(len);
     Ok(ptr)
 }
 
@@ -347,39 +618,80 @@ pub unsafe extern "C" fn zkp_prove(
         let air = read_cstring(air_path)?;
         let pub_inputs = read_cstring(public_inputs_json)?;
 
-        let config = Config::new(backend, field, hash, fri_arity, false, profile);
+        let config = Config::new(backend, field, hash, fri_arity, false, profile)
+            .with_timings(timings_enabled());
         validate_config(&config).map_err(|e| map_capability_error(&e))?;
 
-        let proof = native_prove(&config, &pub_inputs, &air).map_err(|e| map_prove_error(&e))?;
-        let proof_len = proof.len();
-        let proof_len_u64 = u64::try_from(proof_len).map_err(|_| ErrorCode::Internal)?;
-        if proof_len < 40 {
-            return Err(ErrorCode::Internal);
-        }
-        let header = ProofHeader::decode(&proof[0..40]).map_err(|_| ErrorCode::Internal)?;
-        let body = &proof[40..];
-        let digest = digest_D(&header, body);
-        let digest_hex = hex_encode(&digest);
+        let air = load_air_cached(&config, &air)?;
+        let (proof, timings) = native_prove_prepared_timed(&config, &pub_inputs, &air)
+            .map_err(|e| map_prove_error(&e))?;
+        emit_prove_outputs(proof, timings, out_proof, out_proof_len, out_json_meta)
+    })())
+}
 
-        let meta_envelope = with_version(with_field(
-            with_field(ok(), "digest", digest_hex),
-            "proof_len",
-            proof_len_u64,
-        ));
-        let meta_json = meta_envelope.into_string();
-        let meta_ptr = alloc_cstring(&meta_json)?;
+/// Whether prove meta envelopes should carry per-stage timings. Checked once:
+/// set `ZKPROV_TIMINGS=1` in the process environment to opt every prove call
+/// into [`zkprov_backend_native::StageTimings`] collection.
+fn timings_enabled() -> bool {
+    static ENABLED: OnceLock<bool> = OnceLock::new();
+    *ENABLED.get_or_init(|| {
+        std::env::var("ZKPROV_TIMINGS")
+            .map(|v| v == "1")
+            .unwrap_or(false)
+    })
+}
 
-        let proof_ptr = leak_vec(proof).inspect_err(|_| {
-            release_allocation(meta_ptr as *mut u8);
-        })?;
+/// Meta-envelope `timings` object for one prove call (all microseconds).
+fn timings_field(timings: &StageTimings) -> serde_json::Value {
+    serde_json::json!({
+        "load_micros": timings.load_micros,
+        "validate_micros": timings.validate_micros,
+        "trace_shape_micros": timings.trace_shape_micros,
+        "commit_micros": timings.commit_micros,
+        "encode_micros": timings.encode_micros,
+    })
+}
 
-        unsafe {
-            *out_proof = proof_ptr;
-            *out_proof_len = proof_len_u64;
-            *out_json_meta = meta_ptr;
-        }
-        Ok(())
-    })())
+/// Shared tail of the prove paths: digest the proof, build the meta envelope,
+/// and hand ownership of both allocations to the caller's out-parameters.
+fn emit_prove_outputs(
+    proof: Vec<u8>,
+    timings: Option<StageTimings>,
+    out_proof: *mut *mut u8,
+    out_proof_len: *mut u64,
+    out_json_meta: *mut *mut c_char,
+) -> FfiResult<()> {
+    let proof_len = proof.len();
+    let proof_len_u64 = u64::try_from(proof_len).map_err(|_| ErrorCode::Internal)?;
+    if proof_len < 40 {
+        return Err(ErrorCode::Internal);
+    }
+    let header = ProofHeader::decode(&proof[0..40]).map_err(|_| ErrorCode::Internal)?;
+    let body = &proof[40..];
+    let digest = digest_D(&header, body);
+    let digest_hex = hex_encode(&digest);
+
+    let mut meta_envelope = with_version(with_field(
+        with_field(ok(), "digest", digest_hex),
+        "proof_len",
+        proof_len_u64,
+    ));
+    if let Some(timings) = &timings {
+        meta_envelope = with_field(meta_envelope, "timings", timings_field(timings));
+    }
+    let meta_json = meta_envelope.into_string();
+    let meta_ptr = alloc_cstring(&meta_json)?;
+
+    let proof_ptr = leak_vec(proof).inspect_err(|_| {
+        release_allocation(meta_ptr as *mut u8);
+    })?;
+
+    unsafe {
+        *out_proof = proof_ptr;
+        *out_proof_len = proof_len_u64;
+        *out_json_meta = meta_ptr;
+    }
+    Ok(())
 }
 
 /// # Safety
@@ -416,142 +728,1054 @@ pub unsafe extern "C" fn zkp_verify(
         let air = read_cstring(air_path)?;
         let pub_inputs = read_cstring(public_inputs_json)?;
 
-        let proof_len_usize = usize::try_from(proof_len).map_err(|_| ErrorCode::InvalidArg)?;
-        if proof_len_usize == 0 {
-            return Err(ErrorCode::ProofCorrupt);
-        }
-        if proof_ptr.is_null() {
-            return Err(ErrorCode::InvalidArg);
-        }
-        let proof = unsafe { slice::from_raw_parts(proof_ptr, proof_len_usize) };
-
-        if proof.len() < 40 {
-            return Err(ErrorCode::ProofCorrupt);
-        }
-        let header = ProofHeader::decode(&proof[0..40]).map_err(|_| ErrorCode::ProofCorrupt)?;
-        let body = &proof[40..];
-        if u64::try_from(body.len()).map_err(|_| ErrorCode::Internal)? != header.body_len {
-            return Err(ErrorCode::ProofCorrupt);
-        }
-        let digest = digest_D(&header, body);
-        let digest_hex = hex_encode(&digest);
+        let proof = unsafe { read_proof_slice(proof_ptr, proof_len) }?;
+        let digest_hex = digest_proof(proof)?;
 
         let config = Config::new(backend, field, hash, fri_arity, false, profile);
         validate_config(&config).map_err(|e| map_capability_error(&e))?;
 
-        match native_verify(&config, &pub_inputs, &air, proof) {
+        let air = load_air_cached(&config, &air)?;
+        match native_verify_prepared(&config, &pub_inputs, &air, proof) {
             Ok(true) => {}
             Ok(false) => return Err(ErrorCode::VerifyFail),
             Err(err) => return Err(map_verify_error(&err)),
         }
 
-        let meta_envelope = with_version(with_field(
-            with_field(ok(), "verified", true),
-            "digest",
-            digest_hex,
-        ));
-        let meta_json = meta_envelope.into_string();
-        let meta_ptr = alloc_cstring(&meta_json)?;
-        unsafe {
-            *out_json_meta = meta_ptr;
-        }
-        Ok(())
+        emit_verify_meta(digest_hex, out_json_meta)
     })())
 }
 
-#[no_mangle]
-pub extern "C" fn zkp_alloc(nbytes: u64) -> *mut c_void {
-    match usize::try_from(nbytes) {
-        Ok(len) => match alloc_bytes(len) {
-            Ok(ptr) => ptr.cast(),
-            Err(_) => ptr::null_mut(),
-        },
-        Err(_) => ptr::null_mut(),
+/// Validate a caller-supplied proof pointer/length pair and borrow it as a
+/// slice.
+///
+/// # Safety
+///
+/// When `proof_len` is non-zero, `proof_ptr` must reference a buffer of at
+/// least `proof_len` bytes that outlives the returned slice.
+unsafe fn read_proof_slice<'a>(proof_ptr: *const u8, proof_len: u64) -> FfiResult<&'a [u8]> {
+    let proof_len_usize = usize::try_from(proof_len).map_err(|_| ErrorCode::InvalidArg)?;
+    if proof_len_usize == 0 {
+        return Err(ErrorCode::ProofCorrupt);
+    }
+    if proof_ptr.is_null() {
+        return Err(ErrorCode::InvalidArg);
     }
+    Ok(unsafe { slice::from_raw_parts(proof_ptr, proof_len_usize) })
 }
 
-#[no_mangle]
-pub extern "C" fn zkp_free(ptr: *mut c_void) {
-    if ptr.is_null() {
-        return;
+/// Structural proof checks shared by the verify paths: header decode, body
+/// length consistency, and the EVM digest over header+body.
+fn digest_proof(proof: &[u8]) -> FfiResult<String> {
+    digest_proof_bytes(proof).map(|digest| hex_encode(&digest))
+}
+
+/// Raw-digest variant of [`digest_proof`] for the binary meta path, which
+/// hands the 32 digest bytes to the caller without hex encoding.
+fn digest_proof_bytes(proof: &[u8]) -> FfiResult<[u8; 32]> {
+    if proof.len() < 40 {
+        return Err(ErrorCode::ProofCorrupt);
     }
-    release_allocation(ptr as *mut u8);
+    let header = ProofHeader::decode(&proof[0..40]).map_err(|_| ErrorCode::ProofCorrupt)?;
+    let body = &proof[40..];
+    if u64::try_from(body.len()).map_err(|_| ErrorCode::Internal)? != header.body_len {
+        return Err(ErrorCode::ProofCorrupt);
+    }
+    Ok(digest_D(&header, body))
 }
 
-#[cfg(test)]
-mod tests {
-    use super::*;
-    use serde_json::Value;
-    use std::ffi::{CStr, CString};
-    use std::path::PathBuf;
-    use std::ptr;
+/// BLAKE3-derived 64-bit hash of an id string for [`ZkpProofMeta`] fields.
+fn meta_id_hash(label: &str, id: &str) -> u64 {
+    hash64_by_id("blake3", label, id.as_bytes()).unwrap_or(0)
+}
 
-    fn parse_cstring(cstr: CString) -> Value {
-        let json = cstr
-            .into_string()
-            .expect("ffi_json must emit UTF-8 strings");
-        serde_json::from_str(&json).expect("ffi_json must emit valid JSON")
+fn fill_proof_meta(
+    out_meta: *mut ZkpProofMeta,
+    verified: bool,
+    digest: [u8; 32],
+    proof_len: u64,
+    config: &Config,
+    started: Instant,
+) {
+    let meta = ZkpProofMeta {
+        version: ZKP_META_VERSION,
+        verified: i32::from(verified),
+        digest,
+        proof_len,
+        backend_hash: meta_id_hash("META/BACKEND", &config.backend_id),
+        profile_hash: meta_id_hash("META/PROFILE", &config.profile_id),
+        elapsed_micros: u64::try_from(started.elapsed().as_micros()).unwrap_or(u64::MAX),
+    };
+    unsafe {
+        *out_meta = meta;
     }
+}
 
-    fn workspace_root() -> PathBuf {
-        PathBuf::from(env!("CARGO_MANIFEST_DIR"))
-            .join("..")
-            .join("..")
-    }
+/// Binary-meta variant of [`zkp_prove`]: identical proof output, but the
+/// metadata is written into a caller-owned [`ZkpProofMeta`] struct instead of
+/// a heap-allocated JSON string, skipping the serialize/parse round-trip.
+///
+/// # Safety
+///
+/// - All pointer arguments must be valid for reads of a null-terminated string
+///   (for `*_id`, `air_path`, and `public_inputs_json`).
+/// - `out_proof` and `out_proof_len` carry the same ownership rules as
+///   [`zkp_prove`].
+/// - `out_meta` must be a valid, writable pointer to a `ZkpProofMeta`; it is
+///   zeroed on failure and never allocates, so it needs no release call.
+#[allow(clippy::too_many_arguments)]
+#[no_mangle]
+pub unsafe extern "C" fn zkp_prove2(
+    backend_id: *const c_char,
+    field: *const c_char,
+    hash_id: *const c_char,
+    fri_arity: u32,
+    profile_id: *const c_char,
+    air_path: *const c_char,
+    public_inputs_json: *const c_char,
+    out_proof: *mut *mut u8,
+    out_proof_len: *mut u64,
+    out_meta: *mut ZkpProofMeta,
+) -> i32 {
+    to_i32((|| {
+        let started = Instant::now();
+        ensure_output_ptr(out_proof)?;
+        ensure_output_scalar(out_proof_len)?;
+        ensure_output_scalar(out_meta)?;
+        init_runtime()?;
 
-    fn toy_air_path() -> CString {
-        let path = workspace_root()
-            .join("examples")
-            .join("air")
-            .join("toy.air");
-        CString::new(path.to_str().expect("toy.air path must be UTF-8")).unwrap()
-    }
+        let backend = read_cstring(backend_id)?;
+        let field = read_cstring(field)?;
+        let hash = read_cstring(hash_id)?;
+        let profile = read_cstring(profile_id)?;
+        let air = read_cstring(air_path)?;
+        let pub_inputs = read_cstring(public_inputs_json)?;
 
-    #[test]
-    fn ok_envelope_uses_success_code() {
-        let cstr = ok().into_cstring();
-        let value = parse_cstring(cstr);
-        assert_eq!(value["code"], Value::from(ZKP_OK));
-        assert!(value["ok"].as_bool().unwrap());
-        assert_eq!(value["msg"], Value::from("OK"));
-    }
+        let config = Config::new(backend, field, hash, fri_arity, false, profile);
+        validate_config(&config).map_err(|e| map_capability_error(&e))?;
 
-    #[test]
-    fn proof_corrupt_error_has_correct_code() {
-        let cstr = err(ErrorCode::ProofCorrupt, "proof bytes truncated").into_cstring();
-        let value = parse_cstring(cstr);
-        assert_eq!(value["code"], Value::from(ZKP_ERR_PROOF_CORRUPT));
-        assert!(!value["ok"].as_bool().unwrap());
-    }
+        let air = load_air_cached(&config, &air)?;
+        let proof =
+            native_prove_prepared(&config, &pub_inputs, &air).map_err(|e| map_prove_error(&e))?;
+        let proof_len_u64 = u64::try_from(proof.len()).map_err(|_| ErrorCode::Internal)?;
+        let digest = digest_proof_bytes(&proof).map_err(|_| ErrorCode::Internal)?;
+        let proof_ptr = leak_vec(proof)?;
+        unsafe {
+            *out_proof = proof_ptr;
+            *out_proof_len = proof_len_u64;
+        }
+        fill_proof_meta(out_meta, false, digest, proof_len_u64, &config, started);
+        Ok(())
+    })())
+}
 
-    #[test]
-    fn envelopes_are_proper_c_strings() {
-        let cstr = ok().into_cstring();
-        let bytes_with_nul = cstr.as_bytes_with_nul();
-        assert_eq!(bytes_with_nul.last().copied(), Some(0));
-        let without_nul = &bytes_with_nul[..bytes_with_nul.len() - 1];
-        assert!(std::str::from_utf8(without_nul).is_ok());
-    }
+/// Binary-meta variant of [`zkp_verify`]: same verification semantics, but the
+/// metadata is written into a caller-owned [`ZkpProofMeta`] struct instead of
+/// a heap-allocated JSON string.
+///
+/// # Safety
+///
+/// - All pointer arguments must be valid for reads of a null-terminated string
+///   (for `*_id`, `air_path`, and `public_inputs_json`).
+/// - When `proof_len` is non-zero, `proof_ptr` must reference a buffer of at
+///   least `proof_len` bytes.
+/// - `out_meta` must be a valid, writable pointer to a `ZkpProofMeta`; it is
+///   zeroed on failure and never allocates, so it needs no release call.
+#[allow(clippy::too_many_arguments)]
+#[no_mangle]
+pub unsafe extern "C" fn zkp_verify2(
+    backend_id: *const c_char,
+    field: *const c_char,
+    hash_id: *const c_char,
+    fri_arity: u32,
+    profile_id: *const c_char,
+    air_path: *const c_char,
+    public_inputs_json: *const c_char,
+    proof_ptr: *const u8,
+    proof_len: u64,
+    out_meta: *mut ZkpProofMeta,
+) -> i32 {
+    to_i32((|| {
+        let started = Instant::now();
+        ensure_output_scalar(out_meta)?;
+        init_runtime()?;
 
-    #[test]
-    fn version_function_returns_envelope() {
-        let mut version_ptr: *mut c_char = ptr::null_mut();
-        assert_eq!(unsafe { zkp_version(&mut version_ptr) }, ZKP_OK);
-        assert!(!version_ptr.is_null());
-        let version_json = unsafe { CStr::from_ptr(version_ptr) }
-            .to_str()
-            .expect("version JSON must be UTF-8");
-        let value: Value = serde_json::from_str(version_json).unwrap();
-        assert!(value["ok"].as_bool().unwrap());
-        assert_eq!(value["version"], Value::from(env!("CARGO_PKG_VERSION")));
-        zkp_free(version_ptr.cast());
-    }
+        let backend = read_cstring(backend_id)?;
+        let field = read_cstring(field)?;
+        let hash = read_cstring(hash_id)?;
+        let profile = read_cstring(profile_id)?;
+        let air = read_cstring(air_path)?;
+        let pub_inputs = read_cstring(public_inputs_json)?;
 
-    #[test]
-    fn prove_and_verify_roundtrip_via_ffi() {
-        assert_eq!(zkp_init(), ZKP_OK);
+        let proof = unsafe { read_proof_slice(proof_ptr, proof_len) }?;
+        let digest = digest_proof_bytes(proof)?;
 
-        let mut backends_ptr: *mut c_char = ptr::null_mut();
+        let config = Config::new(backend, field, hash, fri_arity, false, profile);
+        validate_config(&config).map_err(|e| map_capability_error(&e))?;
+
+        let air = load_air_cached(&config, &air)?;
+        match native_verify_prepared(&config, &pub_inputs, &air, proof) {
+            Ok(true) => {}
+            Ok(false) => return Err(ErrorCode::VerifyFail),
+            Err(err) => return Err(map_verify_error(&err)),
+        }
+
+        fill_proof_meta(out_meta, true, digest, proof_len, &config, started);
+        Ok(())
+    })())
+}
+
+fn emit_verify_meta(digest_hex: String, out_json_meta: *mut *mut c_char) -> FfiResult<()> {
+    let meta_envelope = with_version(with_field(
+        with_field(ok(), "verified", true),
+        "digest",
+        digest_hex,
+    ));
+    let meta_json = meta_envelope.into_string();
+    let meta_ptr = alloc_cstring(&meta_json)?;
+    unsafe {
+        *out_json_meta = meta_ptr;
+    }
+    Ok(())
+}
+
+/// Number of worker threads for a batch of `jobs` prove calls. Bounded by the
+/// available cores and by the config's profile thread cap when one is set.
+fn batch_thread_count(jobs: usize, config: &Config) -> usize {
+    let limit = zkprov_corelib::profile::find_profile(&config.profile_id)
+        .map(|p| p.effective_threads())
+        .unwrap_or_else(|| {
+            std::thread::available_parallelism()
+                .map(|n| n.get())
+                .unwrap_or(1)
+        });
+    jobs.clamp(1, limit)
+}
+
+/// Run `count` prove jobs against one prepared AIR across a scoped worker
+/// pool. Results keep their input order; the first error aborts the batch.
+fn prove_batch_prepared(
+    config: &Config,
+    air: &AirProgram,
+    inputs: &[String],
+) -> FfiResult<Vec<Vec<u8>>> {
+    let next = AtomicUsize::new(0);
+    let results: Vec<Mutex<Option<FfiResult<Vec<u8>>>>> =
+        inputs.iter().map(|_| Mutex::new(None)).collect();
+
+    std::thread::scope(|scope| {
+        for _ in 0..batch_thread_count(inputs.len(), config) {
+            scope.spawn(|| loop {
+                let i = next.fetch_add(1, Ordering::Relaxed);
+                if i >= inputs.len() {
+                    break;
+                }
+                let result = native_prove_prepared(config, &inputs[i], air)
+                    .map_err(|e| map_prove_error(&e));
+                if let Ok(mut slot) = results[i].lock() {
+                    *slot = Some(result);
+                }
+            });
+        }
+    });
+
+    let mut proofs = Vec::with_capacity(inputs.len());
+    for slot in results {
+        let result = slot
+            .into_inner()
+            .map_err(|_| ErrorCode::Internal)?
+            .ok_or(ErrorCode::Internal)?;
+        proofs.push(result?);
+    }
+    Ok(proofs)
+}
+
+/// # Safety
+///
+/// - All string arguments must be valid, non-empty, null-terminated UTF-8
+///   strings; they are copied before this function returns.
+/// - `out_job` must point to valid, writable memory where the job handle can
+///   be stored.
+#[allow(clippy::too_many_arguments)]
+#[no_mangle]
+pub unsafe extern "C" fn zkp_prove_start(
+    backend_id: *const c_char,
+    field: *const c_char,
+    hash_id: *const c_char,
+    fri_arity: u32,
+    profile_id: *const c_char,
+    air_path: *const c_char,
+    public_inputs_json: *const c_char,
+    out_job: *mut u64,
+) -> i32 {
+    to_i32((|| {
+        ensure_output_scalar(out_job)?;
+
+        let backend = read_cstring(backend_id)?;
+        let field = read_cstring(field)?;
+        let hash = read_cstring(hash_id)?;
+        let profile = read_cstring(profile_id)?;
+        let air_path = read_cstring(air_path)?;
+        let pub_inputs = read_cstring(public_inputs_json)?;
+
+        let job = Arc::new(ProveJob::new());
+        let id = NEXT_JOB_ID.fetch_add(1, Ordering::Relaxed);
+        prove_jobs()
+            .lock()
+            .map_err(|_| ErrorCode::Internal)?
+            .insert(id, Arc::clone(&job));
+
+        std::thread::spawn(move || {
+            let worker = || -> Option<FfiResult<Vec<u8>>> {
+                if !job.enter_stage(ZKP_STAGE_INIT, 0) {
+                    return None;
+                }
+                if let Err(code) = init_runtime() {
+                    return Some(Err(code));
+                }
+                let config = Config::new(backend, field, hash, fri_arity, false, profile);
+                if let Err(e) = validate_config(&config) {
+                    return Some(Err(map_capability_error(&e)));
+                }
+
+                if !job.enter_stage(ZKP_STAGE_LOAD_AIR, 10) {
+                    return None;
+                }
+                let air = match load_air_cached(&config, &air_path) {
+                    Ok(air) => air,
+                    Err(code) => return Some(Err(code)),
+                };
+
+                if !job.enter_stage(ZKP_STAGE_PROVE, 30) {
+                    return None;
+                }
+                let proof = match native_prove_prepared(&config, &pub_inputs, &air) {
+                    Ok(proof) => proof,
+                    Err(e) => return Some(Err(map_prove_error(&e))),
+                };
+
+                if !job.enter_stage(ZKP_STAGE_ENCODE, 90) {
+                    return None;
+                }
+                Some(Ok(proof))
+            };
+            if let Some(result) = worker() {
+                job.finish(result);
+            }
+        });
+
+        unsafe {
+            *out_job = id;
+        }
+        Ok(())
+    })())
+}
+
+/// # Safety
+///
+/// - `job` must be a handle returned by
+///   [`zkp_prove_start`](crate::zkp_prove_start) that has not yet reached a
+///   terminal state through a previous poll.
+/// - `out_progress` must point to a writable `zkp_progress` struct.
+/// - The proof/meta out-pointers carry the same ownership rules as
+///   [`zkp_prove`](crate::zkp_prove); they are only populated when the
+///   reported state is `ZKP_JOB_DONE`, which also retires the handle.
+#[no_mangle]
+pub unsafe extern "C" fn zkp_prove_poll(
+    job: u64,
+    out_progress: *mut ZkpProgress,
+    out_proof: *mut *mut u8,
+    out_proof_len: *mut u64,
+    out_json_meta: *mut *mut c_char,
+) -> i32 {
+    to_i32((|| {
+        if out_progress.is_null() {
+            return Err(ErrorCode::InvalidArg);
+        }
+        ensure_output_ptr(out_proof)?;
+        ensure_output_scalar(out_proof_len)?;
+        ensure_output_ptr(out_json_meta)?;
+
+        let handle = get_prove_job(job)?;
+        let progress = handle.snapshot();
+        unsafe {
+            *out_progress = progress;
+        }
+
+        match progress.state {
+            ZKP_JOB_DONE => {
+                let proof = handle
+                    .result
+                    .lock()
+                    .map_err(|_| ErrorCode::Internal)?
+                    .take()
+                    .ok_or(ErrorCode::Internal)?;
+                remove_prove_job(job);
+                emit_prove_outputs(proof, None, out_proof, out_proof_len, out_json_meta)
+            }
+            ZKP_JOB_FAILED | ZKP_JOB_CANCELLED => {
+                remove_prove_job(job);
+                Ok(())
+            }
+            _ => Ok(()),
+        }
+    })())
+}
+
+/// Request cancellation of an async prove job. The worker stops at its next
+/// stage boundary; poll until the reported state leaves `ZKP_JOB_RUNNING`.
+/// Returns `ZKP_ERR_INVALID_ARG` for unknown or already-retired handles.
+#[no_mangle]
+pub extern "C" fn zkp_prove_cancel(job: u64) -> i32 {
+    to_i32((|| {
+        let handle = get_prove_job(job)?;
+        handle.cancel.store(true, Ordering::Release);
+        Ok(())
+    })())
+}
+
+/// # Safety
+///
+/// - The configuration string arguments must be valid, non-empty,
+///   null-terminated UTF-8 strings.
+/// - `public_inputs_json` must point to `count` valid, null-terminated UTF-8
+///   strings.
+/// - On success, `*out_proofs` receives an array of `count` proof buffers and
+///   `*out_proof_lens` an array of `count` lengths. The caller must release
+///   each proof buffer, the two arrays, and `*out_json_meta` via `zkp_free`.
+#[allow(clippy::too_many_arguments)]
+#[no_mangle]
+pub unsafe extern "C" fn zkp_prove_batch(
+    backend_id: *const c_char,
+    field: *const c_char,
+    hash_id: *const c_char,
+    fri_arity: u32,
+    profile_id: *const c_char,
+    air_path: *const c_char,
+    public_inputs_json: *const *const c_char,
+    count: u64,
+    out_proofs: *mut *mut *mut u8,
+    out_proof_lens: *mut *mut u64,
+    out_json_meta: *mut *mut c_char,
+) -> i32 {
+    to_i32((|| {
+        ensure_output_ptr(out_proofs)?;
+        ensure_output_ptr(out_proof_lens)?;
+        ensure_output_ptr(out_json_meta)?;
+        init_runtime()?;
+
+        let count = usize::try_from(count).map_err(|_| ErrorCode::InvalidArg)?;
+        if count == 0 || public_inputs_json.is_null() {
+            return Err(ErrorCode::InvalidArg);
+        }
+
+        let backend = read_cstring(backend_id)?;
+        let field = read_cstring(field)?;
+        let hash = read_cstring(hash_id)?;
+        let profile = read_cstring(profile_id)?;
+        let air_path = read_cstring(air_path)?;
+        let input_ptrs = unsafe { slice::from_raw_parts(public_inputs_json, count) };
+        let inputs = input_ptrs
+            .iter()
+            .map(|ptr| read_cstring(*ptr))
+            .collect::<FfiResult<Vec<String>>>()?;
+
+        let config = Config::new(backend, field, hash, fri_arity, false, profile);
+        validate_config(&config).map_err(|e| map_capability_error(&e))?;
+        let air = load_air_cached(&config, &air_path)?;
+
+        let proofs = prove_batch_prepared(&config, &air, &inputs)?;
+
+        // Digest every proof for the combined meta envelope before leaking
+        // anything, so failures cannot strand allocations.
+        let mut entries = Vec::with_capacity(count);
+        for proof in &proofs {
+            let header = ProofHeader::decode(&proof[0..40]).map_err(|_| ErrorCode::Internal)?;
+            let digest_hex = hex_encode(&digest_D(&header, &proof[40..]));
+            entries.push(serde_json::json!({
+                "digest": digest_hex,
+                "proof_len": proof.len() as u64,
+            }));
+        }
+
+        let meta_envelope = with_version(with_field(
+            with_field(ok(), "count", count as u64),
+            "proofs",
+            entries,
+        ));
+        let meta_ptr = alloc_cstring(&meta_envelope.into_string())?;
+
+        let release_all = |proof_ptrs: &[*mut u8], arrays: &[*mut u8]| {
+            for &ptr in proof_ptrs {
+                release_allocation(ptr);
+            }
+            for &ptr in arrays {
+                release_allocation(ptr);
+            }
+            release_allocation(meta_ptr as *mut u8);
+        };
+
+        let mut proof_ptrs = Vec::with_capacity(count);
+        let mut lens = Vec::with_capacity(count);
+        for proof in proofs {
+            let len = proof.len() as u64;
+            match leak_vec(proof) {
+                Ok(ptr) => {
+                    proof_ptrs.push(ptr);
+                    lens.push(len);
+                }
+                Err(code) => {
+                    release_all(&proof_ptrs, &[]);
+                    return Err(code);
+                }
+            }
+        }
+
+        let ptr_array = alloc_bytes(count * std::mem::size_of::<*mut u8>()).inspect_err(|_| {
+            release_all(&proof_ptrs, &[]);
+        })?;
+        let len_array = alloc_bytes(count * std::mem::size_of::<u64>()).inspect_err(|_| {
+            release_all(&proof_ptrs, &[ptr_array]);
+        })?;
+        unsafe {
+            ptr::copy_nonoverlapping(proof_ptrs.as_ptr(), ptr_array as *mut *mut u8, count);
+            ptr::copy_nonoverlapping(lens.as_ptr(), len_array as *mut u64, count);
+            *out_proofs = ptr_array as *mut *mut u8;
+            *out_proof_lens = len_array as *mut u64;
+            *out_json_meta = meta_ptr;
+        }
+        Ok(())
+    })())
+}
+
+/// Aggregate `count` leaf proofs over one AIR into a single proof whose size
+/// and verification cost are independent of `count`. Every leaf is verified
+/// (in parallel, up to the profile's thread cap) before the fold runs.
+///
+/// # Safety
+///
+/// - All `*_id`, `air_path` arguments must be valid, null-terminated UTF-8
+///   strings.
+/// - `public_inputs_json` must point to `count` null-terminated UTF-8 strings.
+/// - `proof_lens` must point to `count` lengths and `proofs` to the packed
+///   concatenation of the leaf proof bytes.
+/// - On success, `*out_proof` receives a heap-allocated aggregate proof of
+///   `*out_proof_len` bytes and `*out_json_meta` a meta envelope; both must be
+///   released with `zkp_free` / `zkp_free_string`.
+#[allow(clippy::too_many_arguments)]
+#[no_mangle]
+pub unsafe extern "C" fn zkp_aggregate(
+    backend_id: *const c_char,
+    field: *const c_char,
+    hash_id: *const c_char,
+    fri_arity: u32,
+    profile_id: *const c_char,
+    air_path: *const c_char,
+    public_inputs_json: *const *const c_char,
+    proofs: *const u8,
+    proof_lens: *const u64,
+    count: u64,
+    out_proof: *mut *mut u8,
+    out_proof_len: *mut u64,
+    out_json_meta: *mut *mut c_char,
+) -> i32 {
+    to_i32((|| {
+        ensure_output_ptr(out_proof)?;
+        ensure_output_scalar(out_proof_len)?;
+        ensure_output_ptr(out_json_meta)?;
+        init_runtime()?;
+
+        let count = usize::try_from(count).map_err(|_| ErrorCode::InvalidArg)?;
+        if count == 0 || public_inputs_json.is_null() {
+            return Err(ErrorCode::InvalidArg);
+        }
+
+        let backend = read_cstring(backend_id)?;
+        let field = read_cstring(field)?;
+        let hash = read_cstring(hash_id)?;
+        let profile = read_cstring(profile_id)?;
+        let air_path = read_cstring(air_path)?;
+        let input_ptrs = unsafe { slice::from_raw_parts(public_inputs_json, count) };
+        let inputs = input_ptrs
+            .iter()
+            .map(|ptr| read_cstring(*ptr))
+            .collect::<FfiResult<Vec<String>>>()?;
+        let proof_items = unsafe { read_packed_items(proofs, proof_lens, count) }?;
+
+        let config = Config::new(backend, field, hash, fri_arity, true, profile);
+        validate_config(&config).map_err(|e| map_capability_error(&e))?;
+        let air = load_air_cached(&config, &air_path)?;
+
+        let leaves: Vec<(&str, &[u8])> = inputs
+            .iter()
+            .map(|io| io.as_str())
+            .zip(proof_items)
+            .collect();
+        let aggregate =
+            native_aggregate(&config, &air, &leaves).map_err(|e| map_verify_error(&e))?;
+        emit_prove_outputs(aggregate, None, out_proof, out_proof_len, out_json_meta)
+    })())
+}
+
+/// Request Pedersen commitments in [`zkp_commit_batch`]'s result buffer.
+pub const ZKP_COMMIT_PEDERSEN: u32 = 0x1;
+/// Request a Merkle root over the messages in [`zkp_commit_batch`]'s result
+/// buffer.
+pub const ZKP_COMMIT_MERKLE_ROOT: u32 = 0x2;
+
+/// Compute a Merkle root over `leaves` for a runtime hash id and arity.
+fn merkle_root_by_id(hash_id: &str, arity: u32, leaves: &[Vec<u8>]) -> FfiResult<[u8; 32]> {
+    use zkprov_corelib::crypto::{
+        blake3::Blake3, keccak::Keccak256, merkle, poseidon2::Poseidon2, rescue::Rescue,
+    };
+
+    let id = hash_id.trim().to_ascii_lowercase();
+    match (id.as_str(), arity) {
+        ("blake3", 2) => Ok(merkle::root_arity2::<Blake3>(leaves)),
+        ("blake3", 4) => Ok(merkle::root_arity4::<Blake3>(leaves)),
+        ("keccak256", 2) => Ok(merkle::root_arity2::<Keccak256>(leaves)),
+        ("keccak256", 4) => Ok(merkle::root_arity4::<Keccak256>(leaves)),
+        ("poseidon2", 2) => Ok(merkle::root_arity2::<Poseidon2>(leaves)),
+        ("poseidon2", 4) => Ok(merkle::root_arity4::<Poseidon2>(leaves)),
+        ("rescue", 2) => Ok(merkle::root_arity2::<Rescue>(leaves)),
+        ("rescue", 4) => Ok(merkle::root_arity4::<Rescue>(leaves)),
+        _ => Err(ErrorCode::InvalidArg),
+    }
+}
+
+/// Split a packed `(bytes, lens)` pair into `count` borrowed items.
+///
+/// # Safety
+///
+/// `lens` must point to `count` readable lengths and `bytes` to a buffer of at
+/// least their sum; both must outlive the returned slices.
+unsafe fn read_packed_items<'a>(
+    bytes: *const u8,
+    lens: *const u64,
+    count: usize,
+) -> FfiResult<Vec<&'a [u8]>> {
+    if lens.is_null() {
+        return Err(ErrorCode::InvalidArg);
+    }
+    let lens = unsafe { slice::from_raw_parts(lens, count) };
+    let total: usize = lens
+        .iter()
+        .try_fold(0usize, |acc, &len| {
+            acc.checked_add(usize::try_from(len).ok()?)
+        })
+        .ok_or(ErrorCode::InvalidArg)?;
+    if bytes.is_null() && total > 0 {
+        return Err(ErrorCode::InvalidArg);
+    }
+    let mut items = Vec::with_capacity(count);
+    let mut offset = 0usize;
+    for &len in lens {
+        let len = usize::try_from(len).map_err(|_| ErrorCode::InvalidArg)?;
+        let item = if len == 0 {
+            &[][..]
+        } else {
+            unsafe { slice::from_raw_parts(bytes.add(offset), len) }
+        };
+        items.push(item);
+        offset += len;
+    }
+    Ok(items)
+}
+
+/// Commit to `count` messages in one call.
+///
+/// `mode` is a bitwise OR of `ZKP_COMMIT_PEDERSEN` and
+/// `ZKP_COMMIT_MERKLE_ROOT`. The result buffer is packed as: `count` 64-byte
+/// Pedersen commitments (Cx || Cy, when requested), followed by one 32-byte
+/// Merkle root over the raw messages (when requested).
+///
+/// # Safety
+///
+/// - `hash_id` must be a valid, non-empty, null-terminated UTF-8 string.
+/// - `message_lens` must point to `count` lengths and `messages` to the packed
+///   concatenation of those messages.
+/// - When `ZKP_COMMIT_PEDERSEN` is set, `blindings`/`blinding_lens` must
+///   describe `count` packed blindings the same way; otherwise both may be
+///   NULL.
+/// - On success, `*out_result` receives a heap-allocated buffer of
+///   `*out_result_len` bytes that the caller must release with `zkp_free`.
+#[allow(clippy::too_many_arguments)]
+#[no_mangle]
+pub unsafe extern "C" fn zkp_commit_batch(
+    hash_id: *const c_char,
+    mode: u32,
+    merkle_arity: u32,
+    messages: *const u8,
+    message_lens: *const u64,
+    count: u64,
+    blindings: *const u8,
+    blinding_lens: *const u64,
+    out_result: *mut *mut u8,
+    out_result_len: *mut u64,
+) -> i32 {
+    to_i32((|| {
+        ensure_output_ptr(out_result)?;
+        ensure_output_scalar(out_result_len)?;
+        init_runtime()?;
+
+        let want_pedersen = mode & ZKP_COMMIT_PEDERSEN != 0;
+        let want_root = mode & ZKP_COMMIT_MERKLE_ROOT != 0;
+        if !want_pedersen && !want_root {
+            return Err(ErrorCode::InvalidArg);
+        }
+
+        let count = usize::try_from(count).map_err(|_| ErrorCode::InvalidArg)?;
+        if count == 0 {
+            return Err(ErrorCode::InvalidArg);
+        }
+        let hash = read_cstring(hash_id)?;
+        let items = unsafe { read_packed_items(messages, message_lens, count) }?;
+
+        let mut result = Vec::new();
+
+        if want_pedersen {
+            let blinds = unsafe { read_packed_items(blindings, blinding_lens, count) }?;
+            let bindings = Bindings {
+                commitments: CommitmentsPolicy {
+                    pedersen: true,
+                    curve: None,
+                    no_r_reuse: Some(false),
+                },
+                hash_id_for_commitments: Some(hash.clone()),
+            };
+            let ctx = PedersenCtx::from_bindings(&bindings).map_err(|_| ErrorCode::InvalidArg)?;
+            let mut tracker = BlindingTracker::new();
+            result.reserve(count * 64);
+            for (msg, blind) in items.iter().zip(&blinds) {
+                let commit = ctx
+                    .commit(&mut tracker, msg, blind)
+                    .map_err(|_| ErrorCode::InvalidArg)?;
+                result.extend_from_slice(&commit.cx);
+                result.extend_from_slice(&commit.cy);
+            }
+        }
+
+        if want_root {
+            let leaves: Vec<Vec<u8>> = items.iter().map(|item| item.to_vec()).collect();
+            let root = merkle_root_by_id(&hash, merkle_arity, &leaves)?;
+            result.extend_from_slice(&root);
+        }
+
+        let result_len = u64::try_from(result.len()).map_err(|_| ErrorCode::Internal)?;
+        let result_ptr = leak_vec(result)?;
+        unsafe {
+            *out_result = result_ptr;
+            *out_result_len = result_len;
+        }
+        Ok(())
+    })())
+}
+
+/// # Safety
+///
+/// - `backend_id`, `field`, `hash_id`, `profile_id`, and `air_path` must be
+///   valid, non-empty, null-terminated UTF-8 strings.
+/// - `out_session` must point to valid, writable memory where the session
+///   handle can be stored. The handle stays valid until passed to
+///   [`zkp_session_close`](crate::zkp_session_close).
+#[no_mangle]
+pub unsafe extern "C" fn zkp_session_open(
+    backend_id: *const c_char,
+    field: *const c_char,
+    hash_id: *const c_char,
+    fri_arity: u32,
+    profile_id: *const c_char,
+    air_path: *const c_char,
+    out_session: *mut u64,
+) -> i32 {
+    to_i32((|| {
+        ensure_output_scalar(out_session)?;
+        init_runtime()?;
+
+        let backend = read_cstring(backend_id)?;
+        let field = read_cstring(field)?;
+        let hash = read_cstring(hash_id)?;
+        let profile = read_cstring(profile_id)?;
+        let air = read_cstring(air_path)?;
+
+        let config = Config::new(backend, field, hash, fri_arity, false, profile);
+        validate_config(&config).map_err(|e| map_capability_error(&e))?;
+
+        let air = load_air_cached(&config, &air)?;
+
+        let id = insert_session(Session { config, air })?;
+        unsafe {
+            *out_session = id;
+        }
+        Ok(())
+    })())
+}
+
+/// # Safety
+///
+/// - `backend_id`, `field`, `hash_id`, and `profile_id` must be valid,
+///   non-empty, null-terminated UTF-8 strings.
+/// - `air_ptr`/`air_len` must reference a caller-owned compiled AIR artifact
+///   (see `zkd compile`); the bytes are decoded before this function returns
+///   and need not outlive the call.
+/// - `out_session` follows the rules of
+///   [`zkp_session_open`](crate::zkp_session_open).
+#[allow(clippy::too_many_arguments)]
+#[no_mangle]
+pub unsafe extern "C" fn zkp_session_open_mem(
+    backend_id: *const c_char,
+    field: *const c_char,
+    hash_id: *const c_char,
+    fri_arity: u32,
+    profile_id: *const c_char,
+    air_ptr: *const u8,
+    air_len: u64,
+    out_session: *mut u64,
+) -> i32 {
+    to_i32((|| {
+        ensure_output_scalar(out_session)?;
+        init_runtime()?;
+
+        let backend = read_cstring(backend_id)?;
+        let field = read_cstring(field)?;
+        let hash = read_cstring(hash_id)?;
+        let profile = read_cstring(profile_id)?;
+
+        let air_len = usize::try_from(air_len).map_err(|_| ErrorCode::InvalidArg)?;
+        if air_ptr.is_null() || air_len == 0 {
+            return Err(ErrorCode::InvalidArg);
+        }
+        let air_bytes = unsafe { slice::from_raw_parts(air_ptr, air_len) };
+
+        let config = Config::new(backend, field, hash, fri_arity, false, profile);
+        validate_config(&config).map_err(|e| map_capability_error(&e))?;
+
+        let air = compiled::load_from_bytes(air_bytes).map_err(|_| ErrorCode::InvalidArg)?;
+        validate_air_against_backend(&air, &config.backend_id)
+            .map_err(|e| map_capability_error(&e))?;
+
+        let id = insert_session(Session {
+            config,
+            air: Arc::new(air),
+        })?;
+        unsafe {
+            *out_session = id;
+        }
+        Ok(())
+    })())
+}
+
+/// # Safety
+///
+/// - `session` must be a handle returned by
+///   [`zkp_session_open`](crate::zkp_session_open) that has not been closed.
+/// - `public_inputs_json` must be a valid, null-terminated UTF-8 string.
+/// - The out-pointers carry the same ownership rules as
+///   [`zkp_prove`](crate::zkp_prove).
+#[no_mangle]
+pub unsafe extern "C" fn zkp_session_prove(
+    session: u64,
+    public_inputs_json: *const c_char,
+    out_proof: *mut *mut u8,
+    out_proof_len: *mut u64,
+    out_json_meta: *mut *mut c_char,
+) -> i32 {
+    to_i32((|| {
+        ensure_output_ptr(out_proof)?;
+        ensure_output_scalar(out_proof_len)?;
+        ensure_output_ptr(out_json_meta)?;
+
+        let session = get_session(session)?;
+        let pub_inputs = read_cstring(public_inputs_json)?;
+
+        let proof = native_prove_prepared(&session.config, &pub_inputs, &session.air)
+            .map_err(|e| map_prove_error(&e))?;
+        emit_prove_outputs(proof, None, out_proof, out_proof_len, out_json_meta)
+    })())
+}
+
+/// # Safety
+///
+/// - `session` must be a handle returned by
+///   [`zkp_session_open`](crate::zkp_session_open) that has not been closed.
+/// - `public_inputs_json` must be a valid, null-terminated UTF-8 string.
+/// - `proof_ptr`/`proof_len` and `out_json_meta` carry the same rules as
+///   [`zkp_verify`](crate::zkp_verify).
+#[no_mangle]
+pub unsafe extern "C" fn zkp_session_verify(
+    session: u64,
+    public_inputs_json: *const c_char,
+    proof_ptr: *const u8,
+    proof_len: u64,
+    out_json_meta: *mut *mut c_char,
+) -> i32 {
+    to_i32((|| {
+        ensure_output_ptr(out_json_meta)?;
+
+        let session = get_session(session)?;
+        let pub_inputs = read_cstring(public_inputs_json)?;
+        let proof = unsafe { read_proof_slice(proof_ptr, proof_len) }?;
+        let digest_hex = digest_proof(proof)?;
+
+        match native_verify_prepared(&session.config, &pub_inputs, &session.air, proof) {
+            Ok(true) => {}
+            Ok(false) => return Err(ErrorCode::VerifyFail),
+            Err(err) => return Err(map_verify_error(&err)),
+        }
+
+        emit_verify_meta(digest_hex, out_json_meta)
+    })())
+}
+
+/// Close a session handle previously returned by
+/// [`zkp_session_open`](crate::zkp_session_open). In-flight calls holding the
+/// session keep it alive until they return; subsequent calls on the handle
+/// fail with `ZKP_ERR_INVALID_ARG`.
+#[no_mangle]
+pub extern "C" fn zkp_session_close(session: u64) -> i32 {
+    to_i32(remove_session(session))
+}
+
+#[no_mangle]
+pub extern "C" fn zkp_alloc(nbytes: u64) -> *mut c_void {
+    match usize::try_from(nbytes) {
+        Ok(len) => match alloc_bytes(len) {
+            Ok(ptr) => ptr.cast(),
+            Err(_) => ptr::null_mut(),
+        },
+        Err(_) => ptr::null_mut(),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn zkp_free(ptr: *mut c_void) {
+    if ptr.is_null() {
+        return;
+    }
+    release_allocation(ptr as *mut u8);
+}
+
+/// Report allocation-pool statistics as a JSON envelope with `bytes_in_use`,
+/// `peak_bytes_in_use`, `pool_hits`, `pool_misses`, and `hit_rate` fields.
+/// The snapshot is taken before the envelope string itself is allocated.
+///
+/// # Safety
+///
+/// `out_json` must be a valid, writable pointer. On success it receives a
+/// heap-allocated, NUL-terminated string that the caller must release with
+/// `zkp_free`; on failure it is set to NULL.
+#[no_mangle]
+pub unsafe extern "C" fn zkp_alloc_stats(out_json: *mut *mut c_char) -> i32 {
+    to_i32((|| {
+        ensure_output_ptr(out_json)?;
+
+        let stats = pool::stats();
+        let lookups = stats.pool_hits + stats.pool_misses;
+        let hit_rate = if lookups == 0 {
+            0.0
+        } else {
+            stats.pool_hits as f64 / lookups as f64
+        };
+
+        let envelope = with_field(
+            with_field(
+                with_field(
+                    with_field(
+                        with_field(ok(), "bytes_in_use", stats.bytes_in_use),
+                        "peak_bytes_in_use",
+                        stats.peak_bytes_in_use,
+                    ),
+                    "pool_hits",
+                    stats.pool_hits,
+                ),
+                "pool_misses",
+                stats.pool_misses,
+            ),
+            "hit_rate",
+            hit_rate,
+        );
+        let json = envelope.into_string();
+        let ptr = alloc_cstring(&json)?;
+        unsafe {
+            *out_json = ptr;
+        }
+        Ok(())
+    })())
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use serde_json::Value;
+    use std::ffi::{CStr, CString};
+    use std::path::PathBuf;
+    use std::ptr;
+
+    fn parse_cstring(cstr: CString) -> Value {
+        let json = cstr
+            .into_string()
+            .expect("ffi_json must emit UTF-8 strings");
+        serde_json::from_str(&json).expect("ffi_json must emit valid JSON")
+    }
+
+    fn workspace_root() -> PathBuf {
+        PathBuf::from(env!("CARGO_MANIFEST_DIR"))
+            .join("..")
+            .join("..")
+    }
+
+    fn toy_air_path() -> CString {
+        let path = workspace_root()
+            .join("examples")
+            .join("air")
+            .join("toy.air");
+        CString::new(path.to_str().expect("toy.air path must be UTF-8")).unwrap()
+    }
+
+    #[test]
+    fn ok_envelope_uses_success_code() {
+        let cstr = ok().into_cstring();
+        let value = parse_cstring(cstr);
+        assert_eq!(value["code"], Value::from(ZKP_OK));
+        assert!(value["ok"].as_bool().unwrap());
+        assert_eq!(value["msg"], Value::from("OK"));
+    }
+
+    #[test]
+    fn proof_corrupt_error_has_correct_code() {
+        let cstr = err(ErrorCode::ProofCorrupt, "proof bytes truncated").into_cstring();
+        let value = parse_cstring(cstr);
+        assert_eq!(value["code"], Value::from(ZKP_ERR_PROOF_CORRUPT));
+        assert!(!value["ok"].as_bool().unwrap());
+    }
+
+    #[test]
+    fn envelopes_are_proper_c_strings() {
+        let cstr = ok().into_cstring();
+        let bytes_with_nul = cstr.as_bytes_with_nul();
+        assert_eq!(bytes_with_nul.last().copied(), Some(0));
+        let without_nul = &bytes_with_nul[..bytes_with_nul.len() - 1];
+        assert!(std::str::from_utf8(without_nul).is_ok());
+    }
+
+    #[test]
+    fn version_function_returns_envelope() {
+        let mut version_ptr: *mut c_char = ptr::null_mut();
+        assert_eq!(unsafe { zkp_version(&mut version_ptr) }, ZKP_OK);
+        assert!(!version_ptr.is_null());
+        let version_json = unsafe { CStr::from_ptr(version_ptr) }
+            .to_str()
+            .expect("version JSON must be UTF-8");
+        let value: Value = serde_json::from_str(version_json).unwrap();
+        assert!(value["ok"].as_bool().unwrap());
+        assert_eq!(value["version"], Value::from(env!("CARGO_PKG_VERSION")));
+        zkp_free(version_ptr.cast());
+    }
+
+    #[test]
+    fn prove_and_verify_roundtrip_via_ffi() {
+        assert_eq!(zkp_init(), ZKP_OK);
+
+        let mut backends_ptr: *mut c_char = ptr::null_mut();
         assert_eq!(unsafe { zkp_list_backends(&mut backends_ptr) }, ZKP_OK);
         assert!(!backends_ptr.is_null());
         let backends_json = unsafe { CStr::from_ptr(backends_ptr) }
@@ -565,19 +1789,309 @@ mod tests {
             .any(|b| b["id"] == "native@0.0"));
         zkp_free(backends_ptr.cast());
 
-        let mut profiles_ptr: *mut c_char = ptr::null_mut();
-        assert_eq!(unsafe { zkp_list_profiles(&mut profiles_ptr) }, ZKP_OK);
-        assert!(!profiles_ptr.is_null());
-        let profiles_json = unsafe { CStr::from_ptr(profiles_ptr) }
+        let mut profiles_ptr: *mut c_char = ptr::null_mut();
+        assert_eq!(unsafe { zkp_list_profiles(&mut profiles_ptr) }, ZKP_OK);
+        assert!(!profiles_ptr.is_null());
+        let profiles_json = unsafe { CStr::from_ptr(profiles_ptr) }
+            .to_str()
+            .expect("profiles JSON must be UTF-8");
+        let profiles: Value = serde_json::from_str(profiles_json).unwrap();
+        assert!(profiles
+            .as_array()
+            .unwrap()
+            .iter()
+            .any(|p| p["id"] == "balanced"));
+        zkp_free(profiles_ptr.cast());
+
+        let backend = CString::new("native@0.0").unwrap();
+        let field = CString::new("Prime254").unwrap();
+        let hash = CString::new("blake3").unwrap();
+        let profile = CString::new("balanced").unwrap();
+        let air = toy_air_path();
+        let inputs = CString::new("{\"a\":1,\"b\":[2,3]}").unwrap();
+
+        let mut proof_ptr: *mut u8 = ptr::null_mut();
+        let mut proof_len: u64 = 0;
+        let mut prove_meta_ptr: *mut c_char = ptr::null_mut();
+        let status = unsafe {
+            zkp_prove(
+                backend.as_ptr(),
+                field.as_ptr(),
+                hash.as_ptr(),
+                2,
+                profile.as_ptr(),
+                air.as_ptr(),
+                inputs.as_ptr(),
+                &mut proof_ptr,
+                &mut proof_len,
+                &mut prove_meta_ptr,
+            )
+        };
+        assert_eq!(status, ZKP_OK);
+        assert!(proof_len >= 40);
+        assert!(!proof_ptr.is_null());
+        assert!(!prove_meta_ptr.is_null());
+
+        let prove_meta = unsafe { CStr::from_ptr(prove_meta_ptr) }
+            .to_str()
+            .expect("meta must be UTF-8");
+        let prove_meta_json: Value = serde_json::from_str(prove_meta).unwrap();
+        assert!(prove_meta_json["ok"].as_bool().unwrap());
+        assert!(prove_meta_json.get("digest").is_some());
+        assert_eq!(prove_meta_json["proof_len"], Value::from(proof_len));
+        assert_eq!(
+            prove_meta_json["version"],
+            Value::from(env!("CARGO_PKG_VERSION"))
+        );
+
+        let mut verify_meta_ptr: *mut c_char = ptr::null_mut();
+        let status = unsafe {
+            zkp_verify(
+                backend.as_ptr(),
+                field.as_ptr(),
+                hash.as_ptr(),
+                2,
+                profile.as_ptr(),
+                air.as_ptr(),
+                inputs.as_ptr(),
+                proof_ptr as *const u8,
+                proof_len,
+                &mut verify_meta_ptr,
+            )
+        };
+        assert_eq!(status, ZKP_OK);
+        assert!(!verify_meta_ptr.is_null());
+        let verify_meta = unsafe { CStr::from_ptr(verify_meta_ptr) }
+            .to_str()
+            .expect("verify meta must be UTF-8");
+        let verify_meta_json: Value = serde_json::from_str(verify_meta).unwrap();
+        assert!(verify_meta_json["ok"].as_bool().unwrap());
+        assert!(verify_meta_json["verified"].as_bool().unwrap());
+        assert_eq!(verify_meta_json["digest"], prove_meta_json["digest"]);
+        assert_eq!(
+            verify_meta_json["version"],
+            Value::from(env!("CARGO_PKG_VERSION"))
+        );
+
+        zkp_free(prove_meta_ptr.cast());
+        zkp_free(verify_meta_ptr.cast());
+        zkp_free(proof_ptr.cast());
+    }
+
+    #[test]
+    fn async_prove_polls_to_completion() {
+        assert_eq!(zkp_init(), ZKP_OK);
+
+        let backend = CString::new("native@0.0").unwrap();
+        let field = CString::new("Prime254").unwrap();
+        let hash = CString::new("blake3").unwrap();
+        let profile = CString::new("balanced").unwrap();
+        let air = toy_air_path();
+        let inputs = CString::new("{\"a\":1}").unwrap();
+
+        let mut job: u64 = 0;
+        let status = unsafe {
+            zkp_prove_start(
+                backend.as_ptr(),
+                field.as_ptr(),
+                hash.as_ptr(),
+                2,
+                profile.as_ptr(),
+                air.as_ptr(),
+                inputs.as_ptr(),
+                &mut job,
+            )
+        };
+        assert_eq!(status, ZKP_OK);
+        assert_ne!(job, 0);
+
+        let mut progress = ZkpProgress::default();
+        let mut proof_ptr: *mut u8 = ptr::null_mut();
+        let mut proof_len: u64 = 0;
+        let mut meta_ptr: *mut c_char = ptr::null_mut();
+        for _ in 0..1000 {
+            let status = unsafe {
+                zkp_prove_poll(
+                    job,
+                    &mut progress,
+                    &mut proof_ptr,
+                    &mut proof_len,
+                    &mut meta_ptr,
+                )
+            };
+            assert_eq!(status, ZKP_OK);
+            if progress.state != ZKP_JOB_RUNNING {
+                break;
+            }
+            std::thread::sleep(std::time::Duration::from_millis(5));
+        }
+        assert_eq!(progress.state, ZKP_JOB_DONE);
+        assert_eq!(progress.percent, 100);
+        assert!(proof_len >= 40);
+        assert!(!proof_ptr.is_null());
+        assert!(!meta_ptr.is_null());
+        zkp_free(proof_ptr.cast());
+        zkp_free(meta_ptr.cast());
+
+        // The handle is retired once a terminal state is observed.
+        let status = unsafe {
+            zkp_prove_poll(
+                job,
+                &mut progress,
+                &mut proof_ptr,
+                &mut proof_len,
+                &mut meta_ptr,
+            )
+        };
+        assert_eq!(status, ZKP_ERR_INVALID_ARG);
+    }
+
+    #[test]
+    fn async_prove_cancel_is_observed() {
+        assert_eq!(zkp_init(), ZKP_OK);
+
+        let backend = CString::new("native@0.0").unwrap();
+        let field = CString::new("Prime254").unwrap();
+        let hash = CString::new("blake3").unwrap();
+        let profile = CString::new("balanced").unwrap();
+        let air = toy_air_path();
+        let inputs = CString::new("{\"a\":1}").unwrap();
+
+        let mut job: u64 = 0;
+        let status = unsafe {
+            zkp_prove_start(
+                backend.as_ptr(),
+                field.as_ptr(),
+                hash.as_ptr(),
+                2,
+                profile.as_ptr(),
+                air.as_ptr(),
+                inputs.as_ptr(),
+                &mut job,
+            )
+        };
+        assert_eq!(status, ZKP_OK);
+
+        // Cancellation either lands at a stage boundary or the job finishes
+        // first; both leave the handle retired after the terminal poll.
+        let cancel_status = zkp_prove_cancel(job);
+        assert!(cancel_status == ZKP_OK || cancel_status == ZKP_ERR_INVALID_ARG);
+
+        let mut progress = ZkpProgress::default();
+        let mut proof_ptr: *mut u8 = ptr::null_mut();
+        let mut proof_len: u64 = 0;
+        let mut meta_ptr: *mut c_char = ptr::null_mut();
+        for _ in 0..1000 {
+            let status = unsafe {
+                zkp_prove_poll(
+                    job,
+                    &mut progress,
+                    &mut proof_ptr,
+                    &mut proof_len,
+                    &mut meta_ptr,
+                )
+            };
+            if status == ZKP_ERR_INVALID_ARG || progress.state != ZKP_JOB_RUNNING {
+                break;
+            }
+            std::thread::sleep(std::time::Duration::from_millis(5));
+        }
+        assert!(progress.state == ZKP_JOB_CANCELLED || progress.state == ZKP_JOB_DONE);
+        if !proof_ptr.is_null() {
+            zkp_free(proof_ptr.cast());
+        }
+        if !meta_ptr.is_null() {
+            zkp_free(meta_ptr.cast());
+        }
+    }
+
+    #[test]
+    fn prove_batch_matches_single_proofs() {
+        assert_eq!(zkp_init(), ZKP_OK);
+
+        let backend = CString::new("native@0.0").unwrap();
+        let field = CString::new("Prime254").unwrap();
+        let hash = CString::new("blake3").unwrap();
+        let profile = CString::new("balanced").unwrap();
+        let air = toy_air_path();
+
+        let inputs: Vec<CString> = (0..4)
+            .map(|i| CString::new(format!("{{\"a\":{i}}}")).unwrap())
+            .collect();
+        let input_ptrs: Vec<*const c_char> = inputs.iter().map(|s| s.as_ptr()).collect();
+
+        let mut proofs_ptr: *mut *mut u8 = ptr::null_mut();
+        let mut lens_ptr: *mut u64 = ptr::null_mut();
+        let mut meta_ptr: *mut c_char = ptr::null_mut();
+        let status = unsafe {
+            zkp_prove_batch(
+                backend.as_ptr(),
+                field.as_ptr(),
+                hash.as_ptr(),
+                2,
+                profile.as_ptr(),
+                air.as_ptr(),
+                input_ptrs.as_ptr(),
+                input_ptrs.len() as u64,
+                &mut proofs_ptr,
+                &mut lens_ptr,
+                &mut meta_ptr,
+            )
+        };
+        assert_eq!(status, ZKP_OK);
+        assert!(!proofs_ptr.is_null());
+        assert!(!lens_ptr.is_null());
+        assert!(!meta_ptr.is_null());
+
+        let meta_json = unsafe { CStr::from_ptr(meta_ptr) }
             .to_str()
-            .expect("profiles JSON must be UTF-8");
-        let profiles: Value = serde_json::from_str(profiles_json).unwrap();
-        assert!(profiles
-            .as_array()
-            .unwrap()
-            .iter()
-            .any(|p| p["id"] == "balanced"));
-        zkp_free(profiles_ptr.cast());
+            .expect("batch meta must be UTF-8");
+        let meta: Value = serde_json::from_str(meta_json).unwrap();
+        assert_eq!(meta["count"], Value::from(inputs.len() as u64));
+        assert_eq!(meta["proofs"].as_array().unwrap().len(), inputs.len());
+
+        let batch_ptrs = unsafe { slice::from_raw_parts(proofs_ptr, inputs.len()) };
+        let batch_lens = unsafe { slice::from_raw_parts(lens_ptr, inputs.len()) };
+
+        for (i, input) in inputs.iter().enumerate() {
+            let mut single_ptr: *mut u8 = ptr::null_mut();
+            let mut single_len: u64 = 0;
+            let mut single_meta: *mut c_char = ptr::null_mut();
+            let status = unsafe {
+                zkp_prove(
+                    backend.as_ptr(),
+                    field.as_ptr(),
+                    hash.as_ptr(),
+                    2,
+                    profile.as_ptr(),
+                    air.as_ptr(),
+                    input.as_ptr(),
+                    &mut single_ptr,
+                    &mut single_len,
+                    &mut single_meta,
+                )
+            };
+            assert_eq!(status, ZKP_OK);
+            assert_eq!(single_len, batch_lens[i]);
+            let single = unsafe { slice::from_raw_parts(single_ptr, single_len as usize) };
+            let batched =
+                unsafe { slice::from_raw_parts(batch_ptrs[i], batch_lens[i] as usize) };
+            assert_eq!(single, batched);
+            zkp_free(single_ptr.cast());
+            zkp_free(single_meta.cast());
+        }
+
+        for &ptr in batch_ptrs {
+            zkp_free(ptr.cast());
+        }
+        zkp_free(proofs_ptr.cast());
+        zkp_free(lens_ptr.cast());
+        zkp_free(meta_ptr.cast());
+    }
+
+    #[test]
+    fn session_prove_and_verify_roundtrip() {
+        assert_eq!(zkp_init(), ZKP_OK);
 
         let backend = CString::new("native@0.0").unwrap();
         let field = CString::new("Prime254").unwrap();
@@ -586,9 +2100,42 @@ mod tests {
         let air = toy_air_path();
         let inputs = CString::new("{\"a\":1,\"b\":[2,3]}").unwrap();
 
+        let mut session: u64 = 0;
+        let status = unsafe {
+            zkp_session_open(
+                backend.as_ptr(),
+                field.as_ptr(),
+                hash.as_ptr(),
+                2,
+                profile.as_ptr(),
+                air.as_ptr(),
+                &mut session,
+            )
+        };
+        assert_eq!(status, ZKP_OK);
+        assert_ne!(session, 0);
+
         let mut proof_ptr: *mut u8 = ptr::null_mut();
         let mut proof_len: u64 = 0;
-        let mut prove_meta_ptr: *mut c_char = ptr::null_mut();
+        let mut meta_ptr: *mut c_char = ptr::null_mut();
+        let status = unsafe {
+            zkp_session_prove(
+                session,
+                inputs.as_ptr(),
+                &mut proof_ptr,
+                &mut proof_len,
+                &mut meta_ptr,
+            )
+        };
+        assert_eq!(status, ZKP_OK);
+        assert!(proof_len >= 40);
+        assert!(!proof_ptr.is_null());
+        assert!(!meta_ptr.is_null());
+
+        // Session proofs must match the one-shot path byte for byte.
+        let mut oneshot_ptr: *mut u8 = ptr::null_mut();
+        let mut oneshot_len: u64 = 0;
+        let mut oneshot_meta: *mut c_char = ptr::null_mut();
         let status = unsafe {
             zkp_prove(
                 backend.as_ptr(),
@@ -598,31 +2145,203 @@ mod tests {
                 profile.as_ptr(),
                 air.as_ptr(),
                 inputs.as_ptr(),
+                &mut oneshot_ptr,
+                &mut oneshot_len,
+                &mut oneshot_meta,
+            )
+        };
+        assert_eq!(status, ZKP_OK);
+        assert_eq!(oneshot_len, proof_len);
+        let session_proof =
+            unsafe { slice::from_raw_parts(proof_ptr, proof_len as usize) }.to_vec();
+        let oneshot_proof =
+            unsafe { slice::from_raw_parts(oneshot_ptr, oneshot_len as usize) }.to_vec();
+        assert_eq!(session_proof, oneshot_proof);
+        zkp_free(oneshot_ptr.cast());
+        zkp_free(oneshot_meta.cast());
+
+        let mut verify_meta: *mut c_char = ptr::null_mut();
+        let status = unsafe {
+            zkp_session_verify(
+                session,
+                inputs.as_ptr(),
+                proof_ptr as *const u8,
+                proof_len,
+                &mut verify_meta,
+            )
+        };
+        assert_eq!(status, ZKP_OK);
+        let verify_json = unsafe { CStr::from_ptr(verify_meta) }
+            .to_str()
+            .expect("verify meta must be UTF-8");
+        let verify_value: Value = serde_json::from_str(verify_json).unwrap();
+        assert!(verify_value["verified"].as_bool().unwrap());
+
+        zkp_free(meta_ptr.cast());
+        zkp_free(verify_meta.cast());
+        zkp_free(proof_ptr.cast());
+
+        assert_eq!(zkp_session_close(session), ZKP_OK);
+        assert_eq!(zkp_session_close(session), ZKP_ERR_INVALID_ARG);
+
+        let mut stale_ptr: *mut u8 = ptr::null_mut();
+        let mut stale_len: u64 = 0;
+        let mut stale_meta: *mut c_char = ptr::null_mut();
+        let status = unsafe {
+            zkp_session_prove(
+                session,
+                inputs.as_ptr(),
+                &mut stale_ptr,
+                &mut stale_len,
+                &mut stale_meta,
+            )
+        };
+        assert_eq!(status, ZKP_ERR_INVALID_ARG);
+    }
+
+    #[test]
+    fn compiled_air_session_matches_source_air() {
+        assert_eq!(zkp_init(), ZKP_OK);
+
+        let backend = CString::new("native@0.0").unwrap();
+        let field = CString::new("Prime254").unwrap();
+        let hash = CString::new("blake3").unwrap();
+        let profile = CString::new("balanced").unwrap();
+        let air_path = toy_air_path();
+        let inputs = CString::new("{\"a\":1}").unwrap();
+
+        let program = AirProgram::load_from_file(air_path.to_str().unwrap()).unwrap();
+        let blob = compiled::compile(&program).unwrap();
+
+        let mut session: u64 = 0;
+        let status = unsafe {
+            zkp_session_open_mem(
+                backend.as_ptr(),
+                field.as_ptr(),
+                hash.as_ptr(),
+                2,
+                profile.as_ptr(),
+                blob.as_ptr(),
+                blob.len() as u64,
+                &mut session,
+            )
+        };
+        assert_eq!(status, ZKP_OK);
+
+        let mut proof_ptr: *mut u8 = ptr::null_mut();
+        let mut proof_len: u64 = 0;
+        let mut meta_ptr: *mut c_char = ptr::null_mut();
+        let status = unsafe {
+            zkp_session_prove(
+                session,
+                inputs.as_ptr(),
                 &mut proof_ptr,
                 &mut proof_len,
-                &mut prove_meta_ptr,
+                &mut meta_ptr,
             )
         };
         assert_eq!(status, ZKP_OK);
-        assert!(proof_len >= 40);
-        assert!(!proof_ptr.is_null());
-        assert!(!prove_meta_ptr.is_null());
 
-        let prove_meta = unsafe { CStr::from_ptr(prove_meta_ptr) }
+        let mut src_ptr: *mut u8 = ptr::null_mut();
+        let mut src_len: u64 = 0;
+        let mut src_meta: *mut c_char = ptr::null_mut();
+        let status = unsafe {
+            zkp_prove(
+                backend.as_ptr(),
+                field.as_ptr(),
+                hash.as_ptr(),
+                2,
+                profile.as_ptr(),
+                air_path.as_ptr(),
+                inputs.as_ptr(),
+                &mut src_ptr,
+                &mut src_len,
+                &mut src_meta,
+            )
+        };
+        assert_eq!(status, ZKP_OK);
+        assert_eq!(proof_len, src_len);
+        let compiled_proof = unsafe { slice::from_raw_parts(proof_ptr, proof_len as usize) };
+        let source_proof = unsafe { slice::from_raw_parts(src_ptr, src_len as usize) };
+        assert_eq!(compiled_proof, source_proof);
+
+        zkp_free(proof_ptr.cast());
+        zkp_free(meta_ptr.cast());
+        zkp_free(src_ptr.cast());
+        zkp_free(src_meta.cast());
+        assert_eq!(zkp_session_close(session), ZKP_OK);
+    }
+
+    #[test]
+    fn binary_meta_matches_json_envelope() {
+        assert_eq!(zkp_init(), ZKP_OK);
+
+        let backend = CString::new("native@0.0").unwrap();
+        let field = CString::new("Prime254").unwrap();
+        let hash = CString::new("blake3").unwrap();
+        let profile = CString::new("balanced").unwrap();
+        let air = toy_air_path();
+        let inputs = CString::new("{\"a\":1,\"b\":[2,3]}").unwrap();
+
+        let mut json_proof_ptr: *mut u8 = ptr::null_mut();
+        let mut json_proof_len: u64 = 0;
+        let mut json_meta_ptr: *mut c_char = ptr::null_mut();
+        let status = unsafe {
+            zkp_prove(
+                backend.as_ptr(),
+                field.as_ptr(),
+                hash.as_ptr(),
+                2,
+                profile.as_ptr(),
+                air.as_ptr(),
+                inputs.as_ptr(),
+                &mut json_proof_ptr,
+                &mut json_proof_len,
+                &mut json_meta_ptr,
+            )
+        };
+        assert_eq!(status, ZKP_OK);
+        let json_meta = unsafe { CStr::from_ptr(json_meta_ptr) }
             .to_str()
             .expect("meta must be UTF-8");
-        let prove_meta_json: Value = serde_json::from_str(prove_meta).unwrap();
-        assert!(prove_meta_json["ok"].as_bool().unwrap());
-        assert!(prove_meta_json.get("digest").is_some());
-        assert_eq!(prove_meta_json["proof_len"], Value::from(proof_len));
+        let json_meta: Value = serde_json::from_str(json_meta).unwrap();
+
+        let mut proof_ptr: *mut u8 = ptr::null_mut();
+        let mut proof_len: u64 = 0;
+        let mut meta = ZkpProofMeta::default();
+        let status = unsafe {
+            zkp_prove2(
+                backend.as_ptr(),
+                field.as_ptr(),
+                hash.as_ptr(),
+                2,
+                profile.as_ptr(),
+                air.as_ptr(),
+                inputs.as_ptr(),
+                &mut proof_ptr,
+                &mut proof_len,
+                &mut meta,
+            )
+        };
+        assert_eq!(status, ZKP_OK);
+        assert_eq!(proof_len, json_proof_len);
+        let json_proof = unsafe { slice::from_raw_parts(json_proof_ptr, json_proof_len as usize) };
+        let bin_proof = unsafe { slice::from_raw_parts(proof_ptr, proof_len as usize) };
+        assert_eq!(bin_proof, json_proof);
+
+        assert_eq!(meta.version, ZKP_META_VERSION);
+        assert_eq!(meta.verified, 0);
+        assert_eq!(meta.proof_len, proof_len);
         assert_eq!(
-            prove_meta_json["version"],
-            Value::from(env!("CARGO_PKG_VERSION"))
+            json_meta["digest"],
+            Value::from(hex_encode(&meta.digest))
         );
+        assert_eq!(meta.backend_hash, meta_id_hash("META/BACKEND", "native@0.0"));
+        assert_eq!(meta.profile_hash, meta_id_hash("META/PROFILE", "balanced"));
 
-        let mut verify_meta_ptr: *mut c_char = ptr::null_mut();
+        let mut verify_meta = ZkpProofMeta::default();
         let status = unsafe {
-            zkp_verify(
+            zkp_verify2(
                 backend.as_ptr(),
                 field.as_ptr(),
                 hash.as_ptr(),
@@ -632,26 +2351,139 @@ mod tests {
                 inputs.as_ptr(),
                 proof_ptr as *const u8,
                 proof_len,
-                &mut verify_meta_ptr,
+                &mut verify_meta,
             )
         };
         assert_eq!(status, ZKP_OK);
-        assert!(!verify_meta_ptr.is_null());
-        let verify_meta = unsafe { CStr::from_ptr(verify_meta_ptr) }
-            .to_str()
-            .expect("verify meta must be UTF-8");
-        let verify_meta_json: Value = serde_json::from_str(verify_meta).unwrap();
-        assert!(verify_meta_json["ok"].as_bool().unwrap());
-        assert!(verify_meta_json["verified"].as_bool().unwrap());
-        assert_eq!(verify_meta_json["digest"], prove_meta_json["digest"]);
-        assert_eq!(
-            verify_meta_json["version"],
-            Value::from(env!("CARGO_PKG_VERSION"))
-        );
+        assert_eq!(verify_meta.version, ZKP_META_VERSION);
+        assert_eq!(verify_meta.verified, 1);
+        assert_eq!(verify_meta.digest, meta.digest);
+        assert_eq!(verify_meta.proof_len, proof_len);
+
+        let mut failed_meta = ZkpProofMeta {
+            verified: 1,
+            ..ZkpProofMeta::default()
+        };
+        let status = unsafe {
+            zkp_verify2(
+                backend.as_ptr(),
+                field.as_ptr(),
+                hash.as_ptr(),
+                2,
+                profile.as_ptr(),
+                air.as_ptr(),
+                inputs.as_ptr(),
+                ptr::null(),
+                0,
+                &mut failed_meta,
+            )
+        };
+        assert_eq!(status, ZKP_ERR_PROOF_CORRUPT);
+        assert_eq!(failed_meta.verified, 0);
 
-        zkp_free(prove_meta_ptr.cast());
-        zkp_free(verify_meta_ptr.cast());
         zkp_free(proof_ptr.cast());
+        zkp_free(json_proof_ptr.cast());
+        zkp_free(json_meta_ptr.cast());
+    }
+
+    #[test]
+    fn commit_batch_matches_per_item_gadgets() {
+        use zkprov_corelib::crypto::blake3::Blake3;
+        use zkprov_corelib::crypto::merkle::root_arity2;
+
+        let messages: Vec<&[u8]> = vec![b"alpha", b"beta", b"gamma"];
+        let blindings: Vec<&[u8]> = vec![b"r0", b"r1", b"r2"];
+        let packed_msgs: Vec<u8> = messages.concat();
+        let msg_lens: Vec<u64> = messages.iter().map(|m| m.len() as u64).collect();
+        let packed_blinds: Vec<u8> = blindings.concat();
+        let blind_lens: Vec<u64> = blindings.iter().map(|b| b.len() as u64).collect();
+
+        let hash = CString::new("blake3").unwrap();
+        let mut result_ptr: *mut u8 = ptr::null_mut();
+        let mut result_len: u64 = 0;
+        let status = unsafe {
+            zkp_commit_batch(
+                hash.as_ptr(),
+                ZKP_COMMIT_PEDERSEN | ZKP_COMMIT_MERKLE_ROOT,
+                2,
+                packed_msgs.as_ptr(),
+                msg_lens.as_ptr(),
+                3,
+                packed_blinds.as_ptr(),
+                blind_lens.as_ptr(),
+                &mut result_ptr,
+                &mut result_len,
+            )
+        };
+        assert_eq!(status, ZKP_OK);
+        assert_eq!(result_len, 3 * 64 + 32);
+        let result = unsafe { slice::from_raw_parts(result_ptr, result_len as usize) };
+
+        let bindings = Bindings {
+            commitments: CommitmentsPolicy {
+                pedersen: true,
+                curve: None,
+                no_r_reuse: Some(false),
+            },
+            hash_id_for_commitments: Some("blake3".into()),
+        };
+        let ctx = PedersenCtx::from_bindings(&bindings).unwrap();
+        let mut tracker = BlindingTracker::new();
+        for (i, (msg, blind)) in messages.iter().zip(&blindings).enumerate() {
+            let expected = ctx.commit(&mut tracker, msg, blind).unwrap();
+            assert_eq!(&result[i * 64..i * 64 + 32], &expected.cx);
+            assert_eq!(&result[i * 64 + 32..i * 64 + 64], &expected.cy);
+        }
+
+        let leaves: Vec<Vec<u8>> = messages.iter().map(|m| m.to_vec()).collect();
+        let expected_root = root_arity2::<Blake3>(&leaves);
+        assert_eq!(&result[3 * 64..], &expected_root);
+
+        zkp_free(result_ptr.cast());
+
+        // Merkle-only mode accepts NULL blindings.
+        let mut root_ptr: *mut u8 = ptr::null_mut();
+        let mut root_len: u64 = 0;
+        let status = unsafe {
+            zkp_commit_batch(
+                hash.as_ptr(),
+                ZKP_COMMIT_MERKLE_ROOT,
+                2,
+                packed_msgs.as_ptr(),
+                msg_lens.as_ptr(),
+                3,
+                ptr::null(),
+                ptr::null(),
+                &mut root_ptr,
+                &mut root_len,
+            )
+        };
+        assert_eq!(status, ZKP_OK);
+        assert_eq!(root_len, 32);
+        let root = unsafe { slice::from_raw_parts(root_ptr, 32) };
+        assert_eq!(root, &expected_root);
+        zkp_free(root_ptr.cast());
+    }
+
+    #[test]
+    fn air_cache_shares_programs_per_profile() {
+        assert_eq!(zkp_init(), ZKP_OK);
+        let path = workspace_root()
+            .join("examples")
+            .join("air")
+            .join("toy.air");
+        let path = path.to_str().unwrap();
+
+        let config = Config::new("native@0.0", "Prime254", "blake3", 2, false, "balanced");
+        let first = load_air_cached(&config, path).unwrap();
+        let second = load_air_cached(&config, path).unwrap();
+        assert!(Arc::ptr_eq(&first, &second));
+
+        // A different profile validates separately and gets its own entry.
+        let other = Config::new("native@0.0", "Prime254", "blake3", 2, false, "dev-fast");
+        let third = load_air_cached(&other, path).unwrap();
+        assert!(!Arc::ptr_eq(&first, &third));
+        assert_eq!(first.meta.name, third.meta.name);
     }
 
     #[test]
@@ -661,4 +2493,26 @@ mod tests {
         zkp_free(ptr);
         zkp_free(ptr);
     }
+
+    #[test]
+    fn alloc_stats_reports_envelope() {
+        let ptr = zkp_alloc(128);
+        assert!(!ptr.is_null());
+
+        let mut stats_ptr: *mut c_char = ptr::null_mut();
+        assert_eq!(unsafe { zkp_alloc_stats(&mut stats_ptr) }, ZKP_OK);
+        assert!(!stats_ptr.is_null());
+        let stats_json = unsafe { CStr::from_ptr(stats_ptr) }
+            .to_str()
+            .expect("stats JSON must be UTF-8");
+        let stats: Value = serde_json::from_str(stats_json).unwrap();
+        assert!(stats["ok"].as_bool().unwrap());
+        assert!(stats["bytes_in_use"].as_u64().unwrap() >= 128);
+        assert!(stats["peak_bytes_in_use"].as_u64().unwrap() >= stats["bytes_in_use"].as_u64().unwrap());
+        let hit_rate = stats["hit_rate"].as_f64().unwrap();
+        assert!((0.0..=1.0).contains(&hit_rate));
+
+        zkp_free(stats_ptr.cast());
+        zkp_free(ptr);
+    }
 }
@@ -0,0 +1,178 @@
+//! Size-classed buffer pool backing the FFI allocation surface.
+//!
+//! Proof buffers and JSON meta strings cross the FFI boundary with mixed
+//! lifetimes, which fragments the global allocator in long-running hosts.
+//! Buffers for the common sizes are instead drawn from per-class free lists
+//! and recycled on `zkp_free`; requests above the largest class fall through
+//! to the global allocator. The pool also keeps the counters surfaced by
+//! `zkp_alloc_stats`.
+
+use std::sync::{Mutex, OnceLock};
+
+/// Size classes, chosen around the common proof-buffer and meta-string sizes.
+/// A request is served from the smallest class that fits it.
+pub const CLASS_SIZES: &[usize] = &[64, 256, 1024, 4096, 16384, 65536];
+
+/// Free buffers retained per class; anything beyond this drops back to the
+/// global allocator so an allocation burst cannot pin memory forever.
+const MAX_FREE_PER_CLASS: usize = 32;
+
+/// Counters surfaced through `zkp_alloc_stats`.
+#[derive(Debug, Clone, Copy, Default)]
+pub struct PoolStats {
+    /// Bytes currently handed out across the FFI boundary.
+    pub bytes_in_use: u64,
+    /// High-water mark of `bytes_in_use`.
+    pub peak_bytes_in_use: u64,
+    /// Pooled requests served from a free list.
+    pub pool_hits: u64,
+    /// Pooled requests that had to hit the global allocator.
+    pub pool_misses: u64,
+}
+
+struct Pool {
+    free: Vec<Vec<Vec<u8>>>,
+    stats: PoolStats,
+}
+
+static POOL: OnceLock<Mutex<Pool>> = OnceLock::new();
+
+fn pool() -> &'static Mutex<Pool> {
+    POOL.get_or_init(|| {
+        Mutex::new(Pool {
+            free: vec![Vec::new(); CLASS_SIZES.len()],
+            stats: PoolStats::default(),
+        })
+    })
+}
+
+/// Index of the smallest class that fits `len`, or `None` when the request is
+/// larger than every class and must use the global allocator.
+fn class_for(len: usize) -> Option<usize> {
+    CLASS_SIZES.iter().position(|&class| len <= class)
+}
+
+fn note_in_use(stats: &mut PoolStats, len: usize) {
+    stats.bytes_in_use = stats.bytes_in_use.saturating_add(len as u64);
+    if stats.bytes_in_use > stats.peak_bytes_in_use {
+        stats.peak_bytes_in_use = stats.bytes_in_use;
+    }
+}
+
+/// Hand out a zeroed buffer of exactly `len` bytes, reusing a pooled buffer
+/// when one of the matching class is free.
+pub fn acquire(len: usize) -> Vec<u8> {
+    let mut guard = match pool().lock() {
+        Ok(guard) => guard,
+        // A poisoned pool only loses recycling; fall through to a fresh vec.
+        Err(_) => return vec![0u8; len],
+    };
+    note_in_use(&mut guard.stats, len);
+
+    if let Some(class) = class_for(len) {
+        if let Some(mut buf) = guard.free[class].pop() {
+            guard.stats.pool_hits += 1;
+            drop(guard);
+            buf.clear();
+            buf.resize(len, 0);
+            return buf;
+        }
+        guard.stats.pool_misses += 1;
+        drop(guard);
+        let mut buf = Vec::with_capacity(CLASS_SIZES[class]);
+        buf.resize(len, 0);
+        return buf;
+    }
+
+    guard.stats.pool_misses += 1;
+    drop(guard);
+    vec![0u8; len]
+}
+
+/// Account for a buffer that was allocated elsewhere (e.g. a proof vector
+/// from the prover) and is now handed across the FFI boundary.
+pub fn track_foreign(len: usize) {
+    if let Ok(mut guard) = pool().lock() {
+        note_in_use(&mut guard.stats, len);
+    }
+}
+
+/// Return a buffer released through `zkp_free`. Buffers whose capacity is
+/// exactly a class size are recycled; everything else drops to the global
+/// allocator.
+pub fn release(buf: Vec<u8>) {
+    let len = buf.len();
+    let Ok(mut guard) = pool().lock() else {
+        return;
+    };
+    guard.stats.bytes_in_use = guard.stats.bytes_in_use.saturating_sub(len as u64);
+
+    let cap = buf.capacity();
+    if let Some(class) = CLASS_SIZES.iter().position(|&size| size == cap) {
+        if guard.free[class].len() < MAX_FREE_PER_CLASS {
+            guard.free[class].push(buf);
+        }
+    }
+}
+
+/// Snapshot the pool counters.
+pub fn stats() -> PoolStats {
+    pool()
+        .lock()
+        .map(|guard| guard.stats)
+        .unwrap_or_default()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn class_for_picks_smallest_fitting_class() {
+        assert_eq!(class_for(1), Some(0));
+        assert_eq!(class_for(64), Some(0));
+        assert_eq!(class_for(65), Some(1));
+        assert_eq!(class_for(65536), Some(CLASS_SIZES.len() - 1));
+        assert_eq!(class_for(65537), None);
+    }
+
+    // Pool counters are process-global and the unit tests run in parallel, so
+    // the stats assertions below stay monotonic rather than exact.
+    #[test]
+    fn released_buffers_are_reused() {
+        let hits_before = stats().pool_hits;
+        let mut buf = acquire(200);
+        assert_eq!(buf.len(), 200);
+        assert_eq!(buf.capacity(), 256);
+        buf[0] = 0xAA;
+        release(buf);
+
+        for _ in 0..16 {
+            let buf = acquire(100);
+            assert_eq!(buf.len(), 100);
+            assert_eq!(buf.capacity(), 256);
+            assert!(buf.iter().all(|&b| b == 0));
+            release(buf);
+        }
+        assert!(stats().pool_hits > hits_before);
+    }
+
+    #[test]
+    fn accounting_tracks_bytes_and_peak() {
+        let before = stats();
+        let buf = acquire(1024);
+        let during = stats();
+        assert!(during.peak_bytes_in_use >= before.peak_bytes_in_use);
+        assert!(during.peak_bytes_in_use >= 1024);
+        release(buf);
+    }
+
+    #[test]
+    fn oversized_requests_fall_through() {
+        let misses_before = stats().pool_misses;
+        let buf = acquire(100_000);
+        assert_eq!(buf.len(), 100_000);
+        assert!(stats().pool_misses > misses_before);
+        release(buf);
+    }
+}
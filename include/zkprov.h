@@ -111,6 +111,280 @@ int32_t zkp_verify(
     char **out_json_meta
 );
 
+/* Layout version of zkp_proof_meta written by this library. */
+#define ZKP_META_VERSION 1
+
+/**
+ * Fixed-layout binary proof metadata written by zkp_prove2/zkp_verify2 as an
+ * alternative to the JSON metadata string. The struct is caller-owned, zeroed
+ * on failure, and never allocates, so it needs no release call.
+ */
+typedef struct zkp_proof_meta {
+    uint32_t version;       /* ZKP_META_VERSION */
+    int32_t verified;       /* 1 when written by a successful verify */
+    uint8_t digest[32];     /* EVM digest D over proof header and body */
+    uint64_t proof_len;     /* proof length in bytes */
+    uint64_t backend_hash;  /* BLAKE3-derived 64-bit hash of the backend id */
+    uint64_t profile_hash;  /* BLAKE3-derived 64-bit hash of the profile id */
+    uint64_t elapsed_micros; /* wall-clock time spent inside the call */
+} zkp_proof_meta;
+
+/**
+ * Binary-meta variant of zkp_prove: identical proof output and ownership
+ * rules for out_proof/out_proof_len, but the metadata is written into
+ * *out_meta instead of a heap-allocated JSON string.
+ */
+int32_t zkp_prove2(
+    const char *backend_id,
+    const char *field,
+    const char *hash_id,
+    uint32_t fri_arity,
+    const char *profile_id,
+    const char *air_path,
+    const char *public_inputs_json,
+    uint8_t **out_proof,
+    uint64_t *out_proof_len,
+    zkp_proof_meta *out_meta
+);
+
+/**
+ * Binary-meta variant of zkp_verify: same verification semantics, but the
+ * metadata is written into *out_meta instead of a heap-allocated JSON string.
+ */
+int32_t zkp_verify2(
+    const char *backend_id,
+    const char *field,
+    const char *hash_id,
+    uint32_t fri_arity,
+    const char *profile_id,
+    const char *air_path,
+    const char *public_inputs_json,
+    const uint8_t *proof_ptr,
+    uint64_t proof_len,
+    zkp_proof_meta *out_meta
+);
+
+/* Async prove job states (zkp_progress.state). */
+#define ZKP_JOB_RUNNING 0
+#define ZKP_JOB_DONE 1
+#define ZKP_JOB_CANCELLED 2
+#define ZKP_JOB_FAILED 3
+
+/* Async prove stages (zkp_progress.stage). */
+#define ZKP_STAGE_INIT 0
+#define ZKP_STAGE_LOAD_AIR 1
+#define ZKP_STAGE_PROVE 2
+#define ZKP_STAGE_ENCODE 3
+
+/**
+ * Progress snapshot for an async prove job. `percent` covers the whole prove
+ * (0..100); `error` carries a ZKP_ERR_* code when state is ZKP_JOB_FAILED.
+ */
+typedef struct zkp_progress {
+    int32_t state;
+    int32_t stage;
+    int32_t percent;
+    int32_t error;
+} zkp_progress;
+
+/**
+ * Start an asynchronous prove job. Parameters follow zkp_prove; all strings
+ * are copied before this function returns. On success, *out_job receives a
+ * handle for zkp_prove_poll/zkp_prove_cancel. On failure, *out_job is 0.
+ */
+int32_t zkp_prove_start(
+    const char *backend_id,
+    const char *field,
+    const char *hash_id,
+    uint32_t fri_arity,
+    const char *profile_id,
+    const char *air_path,
+    const char *public_inputs_json,
+    uint64_t *out_job
+);
+
+/**
+ * Poll an asynchronous prove job.
+ *
+ * Always fills *out_progress. When the reported state is ZKP_JOB_DONE, the
+ * proof/meta out-parameters are populated with the same ownership rules as
+ * zkp_prove and the handle is retired. ZKP_JOB_FAILED and ZKP_JOB_CANCELLED
+ * also retire the handle; further polls return ZKP_ERR_INVALID_ARG.
+ */
+int32_t zkp_prove_poll(
+    uint64_t job,
+    zkp_progress *out_progress,
+    uint8_t **out_proof,
+    uint64_t *out_proof_len,
+    char **out_json_meta
+);
+
+/**
+ * Request cancellation of an async prove job. The worker stops at its next
+ * stage boundary; keep polling until the state leaves ZKP_JOB_RUNNING.
+ */
+int32_t zkp_prove_cancel(uint64_t job);
+
+/**
+ * Generate proofs for `count` public-input sets against one AIR program.
+ *
+ * The AIR is parsed and validated once; jobs fan out across an internal
+ * worker pool bounded by the available cores. Results keep their input order.
+ *
+ * Ownership rules:
+ *   - public_inputs_json must point to `count` caller-owned, NUL-terminated
+ *     UTF-8 strings.
+ *   - On success, *out_proofs receives an array of `count` proof buffers and
+ *     *out_proof_lens an array of `count` lengths. The caller must release
+ *     every proof buffer, both arrays, and *out_json_meta with zkp_free.
+ *   - *out_json_meta receives a combined envelope with a `proofs` array of
+ *     per-proof {digest, proof_len} entries.
+ *   - On failure, all out-parameters are reset and nothing needs freeing.
+ */
+int32_t zkp_prove_batch(
+    const char *backend_id,
+    const char *field,
+    const char *hash_id,
+    uint32_t fri_arity,
+    const char *profile_id,
+    const char *air_path,
+    const char *const *public_inputs_json,
+    uint64_t count,
+    uint8_t ***out_proofs,
+    uint64_t **out_proof_lens,
+    char **out_json_meta
+);
+
+/**
+ * Aggregate `count` leaf proofs over one AIR into a single proof whose size
+ * and verification cost are independent of `count`.
+ *
+ * Contract:
+ *   - public_inputs_json points to `count` null-terminated UTF-8 strings, one
+ *     per leaf, in the order the leaves were proved.
+ *   - proof_lens points to `count` lengths and proofs to the packed
+ *     concatenation of the leaf proof bytes.
+ *   - Every leaf is verified before aggregation; an invalid leaf fails the
+ *     whole call with ZKP_ERR_VERIFY_FAIL.
+ *   - On success, *out_proof receives the aggregate proof and *out_json_meta
+ *     its meta envelope; release both with zkp_free.
+ */
+int32_t zkp_aggregate(
+    const char *backend_id,
+    const char *field,
+    const char *hash_id,
+    uint32_t fri_arity,
+    const char *profile_id,
+    const char *air_path,
+    const char *const *public_inputs_json,
+    const uint8_t *proofs,
+    const uint64_t *proof_lens,
+    uint64_t count,
+    uint8_t **out_proof,
+    uint64_t *out_proof_len,
+    char **out_json_meta
+);
+
+/* Result-selection flags for zkp_commit_batch (bitwise OR). */
+#define ZKP_COMMIT_PEDERSEN 0x1
+#define ZKP_COMMIT_MERKLE_ROOT 0x2
+
+/**
+ * Commit to `count` messages in one call.
+ *
+ * `mode` is a bitwise OR of ZKP_COMMIT_PEDERSEN and ZKP_COMMIT_MERKLE_ROOT.
+ * `message_lens` must point to `count` lengths and `messages` to the packed
+ * concatenation of those messages; when ZKP_COMMIT_PEDERSEN is set,
+ * `blindings`/`blinding_lens` must describe `count` packed blindings the same
+ * way (otherwise both may be NULL). `merkle_arity` selects the tree arity
+ * (2 or 4) when ZKP_COMMIT_MERKLE_ROOT is set.
+ *
+ * The result buffer is packed as: `count` 64-byte Pedersen commitments
+ * (Cx || Cy, when requested), followed by one 32-byte Merkle root over the
+ * raw messages (when requested). On success, *out_result receives a
+ * heap-allocated buffer of *out_result_len bytes that the caller must release
+ * with zkp_free. On failure, both out-parameters are reset.
+ */
+int32_t zkp_commit_batch(
+    const char *hash_id,
+    uint32_t mode,
+    uint32_t merkle_arity,
+    const uint8_t *messages,
+    const uint64_t *message_lens,
+    uint64_t count,
+    const uint8_t *blindings,
+    const uint64_t *blinding_lens,
+    uint8_t **out_result,
+    uint64_t *out_result_len
+);
+
+/**
+ * Open a session that caches the parsed AIR program and validated
+ * configuration, so repeated zkp_session_prove/zkp_session_verify calls skip
+ * per-call setup (init, config validation, AIR parse).
+ *
+ * Parameters follow zkp_prove. On success, *out_session receives an opaque
+ * handle that stays valid until passed to zkp_session_close. On failure,
+ * *out_session is set to 0.
+ */
+int32_t zkp_session_open(
+    const char *backend_id,
+    const char *field,
+    const char *hash_id,
+    uint32_t fri_arity,
+    const char *profile_id,
+    const char *air_path,
+    uint64_t *out_session
+);
+
+/**
+ * Open a session from an in-memory compiled AIR artifact (produced by
+ * `zkd compile`) instead of a file path, so e.g. an mmap'd artifact can be
+ * used without touching the filesystem. The bytes are decoded before this
+ * function returns and need not outlive the call. Other parameters and the
+ * returned handle follow zkp_session_open.
+ */
+int32_t zkp_session_open_mem(
+    const char *backend_id,
+    const char *field,
+    const char *hash_id,
+    uint32_t fri_arity,
+    const char *profile_id,
+    const uint8_t *air_ptr,
+    uint64_t air_len,
+    uint64_t *out_session
+);
+
+/**
+ * Generate a proof using a session opened with zkp_session_open. Output
+ * parameters carry the same ownership rules as zkp_prove.
+ */
+int32_t zkp_session_prove(
+    uint64_t session,
+    const char *public_inputs_json,
+    uint8_t **out_proof,
+    uint64_t *out_proof_len,
+    char **out_json_meta
+);
+
+/**
+ * Verify a proof using a session opened with zkp_session_open. Parameters and
+ * ownership rules mirror zkp_verify.
+ */
+int32_t zkp_session_verify(
+    uint64_t session,
+    const char *public_inputs_json,
+    const uint8_t *proof_ptr,
+    uint64_t proof_len,
+    char **out_json_meta
+);
+
+/**
+ * Close a session handle. Returns ZKP_ERR_INVALID_ARG if the handle is
+ * unknown or already closed.
+ */
+int32_t zkp_session_close(uint64_t session);
+
 /**
  * Allocate a buffer owned by the prover runtime. Callers must eventually
  * release any non-NULL pointer returned from this function with zkp_free.
@@ -125,6 +399,16 @@ void *zkp_alloc(uint64_t nbytes);
  */
 void zkp_free(void *ptr);
 
+/**
+ * Report allocation-pool statistics as a JSON envelope with `bytes_in_use`,
+ * `peak_bytes_in_use`, `pool_hits`, `pool_misses`, and `hit_rate` fields.
+ *
+ * On success, *out_json receives a heap-allocated, NUL-terminated UTF-8 string
+ * that the caller must release with zkp_free. On failure, *out_json is set to
+ * NULL.
+ */
+int32_t zkp_alloc_stats(char **out_json);
+
 #ifdef __cplusplus
 }
 #endif
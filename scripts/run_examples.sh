@@ -231,8 +231,11 @@ run_flutter_example() {
 
 run_wasm_example() {
   build_rust_core
-  info "Building wasm32-wasip1 artifact."
-  "$CARGO_BIN" build -p zkprov-ffi-c --release --target wasm32-wasip1
+  info "Building wasm32-wasip1 artifact (SIMD128 enabled)."
+  # simd128 lets LLVM vectorize the hash inner loops (Keccak/Poseidon2);
+  # every current WASI runtime and browser engine supports it.
+  RUSTFLAGS="${RUSTFLAGS:-} -C target-feature=+simd128" \
+    "$CARGO_BIN" build -p zkprov-ffi-c --release --target wasm32-wasip1
 
   local wasm_path
   wasm_path="$(find "$TARGET_ROOT" -type f -path "*/wasm32-wasip1/release/zkprov.wasm" -print -quit 2>/dev/null || true)"